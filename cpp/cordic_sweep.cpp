@@ -0,0 +1,318 @@
+/*******************************************************************************
+--
+-- Title       : cordic_sweep.cpp
+-- Design      : CORDIC: exhaustive accuracy sweep
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Check every phase of CORDIC (bit-exact model of HLS cordic) for every
+--               (NPHASE, NWIDTH) combination in range on all cores. Result is JSON with
+--               max error, RMS and bias of sine and cosine and per-quadrant histograms.
+--               
+--               Usage: cordic_sweep <NPHASE min> <NPHASE max> <NWIDTH min> <NWIDTH max>
+--                                   [-p NPREC] [-i NITER] [-t threads] [-o result.json]
+--               NITER = 0 (default): full iterations, NITER = NWIDTH
+--               NITER < 0: hybrid CORDIC, NITER = NWIDTH/2 + 2
+--               Example: cordic_sweep 8 16 12 24 -o sweep.json
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <atomic>
+#include <thread>
+
+#include "win_model.h"
+
+/* ---- Phases per work item --- */
+#define SWEEP_BLOCK 65536
+
+/* ---- Error histogram: -HIST_MAX..HIST_MAX LSB, outer bins collect the rest --- */
+#define HIST_MAX 4
+#define HIST_LEN (2*HIST_MAX+1)
+
+typedef struct {
+	long long count;
+	double sum_err;
+	double sum_err2;
+	long long max_err;
+} err_t;
+
+typedef struct {
+	err_t sin;
+	err_t cos;
+	long long hist_sin[4][HIST_LEN];
+	long long hist_cos[4][HIST_LEN];
+} sweep_t;
+
+static void err_add (
+		err_t *res,
+		long long err
+	)
+{
+	long long abs_err = (err < 0) ? -err : err;
+	res->count++;
+	res->sum_err += (double)err;
+	res->sum_err2 += (double)err * (double)err;
+	if (abs_err > res->max_err) {
+		res->max_err = abs_err;
+	}
+}
+
+static void err_merge (
+		err_t *dst,
+		const err_t *src
+	)
+{
+	dst->count += src->count;
+	dst->sum_err += src->sum_err;
+	dst->sum_err2 += src->sum_err2;
+	if (src->max_err > dst->max_err) {
+		dst->max_err = src->max_err;
+	}
+}
+
+static int hist_bin (
+		long long err
+	)
+{
+	if (err < -HIST_MAX) {
+		return 0;
+	}
+	if (err > HIST_MAX) {
+		return HIST_LEN - 1;
+	}
+	return (int)err + HIST_MAX;
+}
+
+static void sweep_block (
+		const win_cfg_t *cfg,
+		long long start,
+		long long count,
+		sweep_t *res
+	)
+{
+	const long long nsamples = 1LL << cfg->nphase;
+	const double scale = pow(2.0, cfg->nwidth-2);
+
+	long long i;
+	for (i = start; i < start + count; i++) {
+		long long c, s;
+		win_cordic(cfg, i, &c, &s);
+
+		long long ts = (long long)round(scale * sin((2 * i * M_PI) / nsamples));
+		long long tc = (long long)round(scale * cos((2 * i * M_PI) / nsamples));
+
+		int quadrant = (int)(i >> (cfg->nphase - 2));
+
+		err_add(&res->sin, s - ts);
+		err_add(&res->cos, c - tc);
+		res->hist_sin[quadrant][hist_bin(s - ts)]++;
+		res->hist_cos[quadrant][hist_bin(c - tc)]++;
+	}
+}
+
+static void print_err (
+		FILE *fout,
+		const char *name,
+		const err_t *res
+	)
+{
+	fprintf(fout, "\"%s\": {\"max\": %lld, \"rms\": %.6f, \"bias\": %.6f}",
+		name, res->max_err, sqrt(res->sum_err2 / res->count), res->sum_err / res->count);
+}
+
+static void print_hist (
+		FILE *fout,
+		const char *name,
+		const long long hist[4][HIST_LEN]
+	)
+{
+	fprintf(fout, "\"%s\": [", name);
+	int q, k;
+	for (q = 0; q < 4; q++) {
+		fprintf(fout, "%s[", q ? ", " : "");
+		for (k = 0; k < HIST_LEN; k++) {
+			fprintf(fout, "%s%lld", k ? ", " : "", hist[q][k]);
+		}
+		fprintf(fout, "]");
+	}
+	fprintf(fout, "]");
+}
+
+int main (int argc, char **argv) {
+
+	if (argc < 5) {
+		printf("Usage: %s <NPHASE min> <NPHASE max> <NWIDTH min> <NWIDTH max> [-p NPREC] [-i NITER] [-t threads] [-o result.json]\n", argv[0]);
+		return 1;
+	}
+
+	int pmin = atoi(argv[1]);
+	int pmax = atoi(argv[2]);
+	int wmin = atoi(argv[3]);
+	int wmax = atoi(argv[4]);
+
+	int nprec = 0;
+	int niter = 0;
+	int nthreads = std::thread::hardware_concurrency();
+	const char *fname = NULL;
+
+	int i;
+	for (i = 5; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-p") == 0) {
+			nprec = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-i") == 0) {
+			niter = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-t") == 0) {
+			nthreads = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-o") == 0) {
+			fname = argv[i+1];
+		}
+	}
+	if (nthreads < 1) {
+		nthreads = 1;
+	}
+	if ((pmin < 3) || (pmax > 32) || (pmin > pmax) || (wmin < 4) || (wmax > 40) || (wmin > wmax)) {
+		printf("FAIL: wrong range of NPHASE or NWIDTH\n");
+		return 1;
+	}
+	// ATAN table is taken as 40 bits (win_cordic, HLS cordic) //
+	if ((nprec < 0) || (wmax + nprec > 40)) {
+		printf("FAIL: NWIDTH + NPREC must not exceed 40\n");
+		return 1;
+	}
+
+	// List of configurations //
+	int ncfg = (pmax - pmin + 1) * (wmax - wmin + 1);
+	win_cfg_t *cfg = (win_cfg_t *)malloc(ncfg * sizeof(win_cfg_t));
+	long long *first = (long long *)malloc((ncfg + 1) * sizeof(long long));
+
+	int p, w, n = 0;
+	long long nitems = 0;
+	for (p = pmin; p <= pmax; p++) {
+		for (w = wmin; w <= wmax; w++) {
+			cfg[n].nphase = p;
+			cfg[n].nwidth = w;
+			cfg[n].nprec = nprec;
+			cfg[n].niter = (niter > 0) ? niter : (niter < 0) ? w / 2 + 2 : w;
+			if (cfg[n].niter > w) {
+				cfg[n].niter = w;
+			}
+			first[n] = nitems;
+			nitems += ((1LL << p) + SWEEP_BLOCK - 1) / SWEEP_BLOCK;
+			n++;
+		}
+	}
+	first[ncfg] = nitems;
+
+	// Work items: blocks of phase for each configuration //
+	std::atomic<long long> next(0);
+	sweep_t *part = (sweep_t *)calloc((size_t)nthreads * ncfg, sizeof(sweep_t));
+	std::thread *pool = new std::thread[nthreads];
+
+	for (i = 0; i < nthreads; i++) {
+		sweep_t *res = &part[(size_t)i * ncfg];
+		pool[i] = std::thread([&, res]() {
+			int idx = 0;
+			for (;;) {
+				long long item = next++;
+				if (item >= nitems) {
+					break;
+				}
+				while (first[idx + 1] <= item) {
+					idx++;
+				}
+				long long nsamples = 1LL << cfg[idx].nphase;
+				long long start = (item - first[idx]) * SWEEP_BLOCK;
+				long long count = (start + SWEEP_BLOCK > nsamples) ? nsamples - start : SWEEP_BLOCK;
+				sweep_block(&cfg[idx], start, count, &res[idx]);
+			}
+		});
+	}
+	for (i = 0; i < nthreads; i++) {
+		pool[i].join();
+	}
+	delete[] pool;
+
+	// Merge results of all threads //
+	int t, q, k;
+	for (t = 1; t < nthreads; t++) {
+		for (n = 0; n < ncfg; n++) {
+			sweep_t *dst = &part[n];
+			sweep_t *src = &part[(size_t)t * ncfg + n];
+			err_merge(&dst->sin, &src->sin);
+			err_merge(&dst->cos, &src->cos);
+			for (q = 0; q < 4; q++) {
+				for (k = 0; k < HIST_LEN; k++) {
+					dst->hist_sin[q][k] += src->hist_sin[q][k];
+					dst->hist_cos[q][k] += src->hist_cos[q][k];
+				}
+			}
+		}
+	}
+
+	FILE *fout = fname ? fopen(fname, "w") : stdout;
+	if (!fout) {
+		printf("FAIL: cannot open %s\n", fname);
+		return 1;
+	}
+
+	fprintf(fout, "{\n  \"hist_range\": [%d, %d],\n  \"results\": [\n", -HIST_MAX, HIST_MAX);
+	for (n = 0; n < ncfg; n++) {
+		fprintf(fout, "    {\"nphase\": %d, \"nwidth\": %d, \"nprec\": %d, \"niter\": %d, ",
+			cfg[n].nphase, cfg[n].nwidth, cfg[n].nprec, cfg[n].niter);
+		print_err(fout, "sin", &part[n].sin);
+		fprintf(fout, ", ");
+		print_err(fout, "cos", &part[n].cos);
+		fprintf(fout, ", ");
+		print_hist(fout, "hist_sin", part[n].hist_sin);
+		fprintf(fout, ", ");
+		print_hist(fout, "hist_cos", part[n].hist_cos);
+		fprintf(fout, "}%s\n", (n + 1 < ncfg) ? "," : "");
+	}
+	fprintf(fout, "  ]\n}\n");
+
+	if (fname) {
+		fclose(fout);
+		printf("%d configurations, %lld work items on %d threads: %s\n", ncfg, nitems, nthreads, fname);
+	}
+
+	free(part);
+	free(first);
+	free(cfg);
+	return 0;
+}
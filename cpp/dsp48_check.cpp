@@ -0,0 +1,254 @@
+/*******************************************************************************
+--
+-- Title       : dsp48_check
+-- Design      : Check of DSP48 multiplier and CORDIC DDS48 models
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Re-runnable check of cpp/dsp48_model: mlt35x25 / mlt35x27 cascades and
+--               int_multNxN (scalar and block) against exact product of random operands
+--               (and min / max corner values), DDS48 block (stage-major) against scalar
+--               cordic_dds48 for several PHASE_WIDTH and DATA_WIDTH.
+--               
+--               Usage: dsp48_check [-n operands] [-s seed]
+--               Example: dsp48_check -n 1000000
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp48_model.h"
+#include "win_tables.h"
+
+/* ---- Default number of random operands --- */
+#define DSP_CHECK_N   1000000
+
+/* ---- xorshift64: reproducible operands --- */
+static unsigned long long next_rand (
+		unsigned long long *seed
+	)
+{
+	unsigned long long x = *seed;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	*seed = x;
+	return x;
+}
+
+/* ---- Operand: random or corner (min, max, -1, 0) of N-bit signed --- */
+static long long operand (
+		unsigned long long *seed,
+		long long i,
+		int bits
+	)
+{
+	switch (i) {
+		case 0: return -(1LL << (bits - 1));
+		case 1: return (1LL << (bits - 1)) - 1;
+		case 2: return -1;
+		case 3: return 0;
+	}
+	return win_wrap((long long)next_rand(seed), bits);
+}
+
+/* ---- mlt35 cascade (nb = 25 or 27): mismatches with exact product --- */
+static long long check_mlt35 (
+		int nb,
+		long long num,
+		unsigned long long seed
+	)
+{
+	long long *a = (long long *)calloc(num, sizeof(long long));
+	long long *b = (long long *)calloc(num, sizeof(long long));
+	long long *p = (long long *)calloc(num, sizeof(long long));
+	long long i, err = 0;
+	if (!a || !b || !p) {
+		free(a);
+		free(b);
+		free(p);
+		return -1;
+	}
+
+	for (i = 0; i < num; i++) {
+		a[i] = operand(&seed, i % 4, 35);
+		b[i] = operand(&seed, i / 4, nb);
+	}
+	if (nb == 25) {
+		mlt35x25_block(a, b, num, p);
+	} else {
+		mlt35x27_block(a, b, num, p);
+	}
+	for (i = 0; i < num; i++) {
+		long long exact = a[i] * b[i];
+		long long scalar = (nb == 25) ? mlt35x25_dsp48e1(a[i], b[i]) : mlt35x27_dsp48e2(a[i], b[i]);
+		if ((p[i] != exact) || (scalar != exact)) {
+			if (err < 4) {
+				printf("  mlt35x%d: %lld * %lld = %lld, block %lld, scalar %lld\n", nb, a[i], b[i], exact, p[i], scalar);
+			}
+			err++;
+		}
+	}
+	free(a);
+	free(b);
+	free(p);
+	return err;
+}
+
+/* ---- int_multNxN_dsp48, DTW 2..32: mismatches with exact product --- */
+static long long check_mult (
+		long long num,
+		unsigned long long seed
+	)
+{
+	long long *a = (long long *)calloc(num, sizeof(long long));
+	long long *b = (long long *)calloc(num, sizeof(long long));
+	long long *q = (long long *)calloc(num, sizeof(long long));
+	long long i, err = 0;
+	if (!a || !b || !q) {
+		free(a);
+		free(b);
+		free(q);
+		return -1;
+	}
+	int dtw;
+
+	for (dtw = 2; dtw <= 32; dtw++) {
+		for (i = 0; i < num; i++) {
+			a[i] = operand(&seed, i % 4, dtw);
+			b[i] = operand(&seed, i / 4, dtw);
+		}
+		dsp48_mult_block(a, b, num, dtw, q);
+		for (i = 0; i < num; i++) {
+			long long exact = a[i] * b[i];
+			if ((q[i] != exact) || (dsp48_mult(a[i], b[i], dtw) != exact)) {
+				if (err < 4) {
+					printf("  mult DTW %d: %lld * %lld = %lld, block %lld\n", dtw, a[i], b[i], exact, q[i]);
+				}
+				err++;
+			}
+		}
+	}
+	free(a);
+	free(b);
+	free(q);
+	return err;
+}
+
+/* ---- DDS48 block against scalar cordic_dds48: mismatches --- */
+static long long check_dds48 (
+		long long num,
+		unsigned long long seed
+	)
+{
+	static const int pws[] = { 8, 12, 16, 24, 32 };
+	static const int dws[] = { 8, 16, 24, 32 };
+
+	long long *ph = (long long *)calloc(num, sizeof(long long));
+	long long *s = (long long *)calloc(num, sizeof(long long));
+	long long *c = (long long *)calloc(num, sizeof(long long));
+	long long i, err = 0;
+	if (!ph || !s || !c) {
+		free(ph);
+		free(s);
+		free(c);
+		return -1;
+	}
+	int p, d;
+
+	for (p = 0; p < (int)(sizeof(pws) / sizeof(pws[0])); p++)
+	for (d = 0; d < (int)(sizeof(dws) / sizeof(dws[0])); d++) {
+		const int pw = pws[p];
+		const int dw = dws[d];
+		// All phases of short period, random phases of long one //
+		for (i = 0; i < num; i++) {
+			ph[i] = (pw <= 16) ? (i & ((1LL << pw) - 1)) : (long long)(next_rand(&seed) & ((1ULL << pw) - 1));
+		}
+		dds48_block(pw, dw, ph, num, s, c);
+		for (i = 0; i < num; i++) {
+			long long ss, cc;
+			dds48_cordic(pw, dw, ph[i], &ss, &cc);
+			if ((ss != s[i]) || (cc != c[i])) {
+				if (err < 4) {
+					printf("  dds48 PHASE %d DATA %d: phase %lld, scalar %lld %lld, block %lld %lld\n", pw, dw, ph[i], ss, cc, s[i], c[i]);
+				}
+				err++;
+			}
+		}
+	}
+	free(ph);
+	free(s);
+	free(c);
+	return err;
+}
+
+int main (int argc, char **argv) {
+
+	long long num = DSP_CHECK_N;
+	unsigned long long seed = 0x9E3779B97F4A7C15ULL;
+
+	int i;
+	for (i = 1; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-n") == 0) {
+			num = atoll(argv[i+1]);
+		} else if (strcmp(argv[i], "-s") == 0) {
+			seed = strtoull(argv[i+1], NULL, 0);
+		}
+	}
+	if ((num < 16) || (seed == 0)) {
+		printf("Usage: %s [-n operands (16 or more)] [-s seed (not 0)]\n", argv[0]);
+		return 1;
+	}
+
+	long long err25 = check_mlt35(25, num, seed);
+	long long err27 = check_mlt35(27, num, seed);
+	long long errnn = check_mult(num / 16, seed);
+	long long errdds = check_dds48(num / 16, seed);
+
+	printf("{\"operands\": %lld, \"mlt35x25\": %lld, \"mlt35x27\": %lld, \"multNxN\": %lld, \"dds48\": %lld}\n",
+		num, err25, err27, errnn, errdds);
+
+	if ((err25 < 0) || (err27 < 0) || (errnn < 0) || (errdds < 0)) {
+		printf("FAIL: cannot allocate operands\n");
+		return 1;
+	}
+	if (err25 || err27 || errnn || errdds) {
+		printf("FAIL: DSP48 model differs from exact product or scalar DDS48\n");
+		return 1;
+	}
+	printf("PASS: DSP48 models match exact products, DDS48 block matches scalar\n");
+	return 0;
+}
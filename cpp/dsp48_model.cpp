@@ -0,0 +1,262 @@
+/*******************************************************************************
+--
+-- Title       : dsp48_model.cpp
+-- Design      : Bit-true models of DSP48 multipliers and CORDIC DDS48
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Native emulation of int_multNxN_dsp48.vhd, mults/mlt35x25_dsp48e1.vhd,
+--               mults/mlt35x27_dsp48e2.vhd and the 48-bit datapath of cordic_dds48.vhd.
+--               
+--               Wide multipliers: A port is split to 17 unsigned LSBs (DSP M2) and
+--               signed MSBs (DSP M1), M2 product goes to M1 by PCIN >> 17 (OPMODE Z=101).
+--               Every DSP48 P register wraps to 48 bits.
+--               
+--               DDS48 block: all samples of a chunk go through one CORDIC stage at a time,
+--               add / subtract is selected by sign mask (no branches), so inner loops
+--               can be vectorized by compiler.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include "dsp48_model.h"
+#include "win_tables.h"
+
+/* ---- CORDIC DDS48 look-up table: ATAN(2^-i) * (2^48 / (2*PI))
+	(gain and wrap are WIN_GAIN48 and win_wrap of win_tables.h) --- */
+static const long long ROM_LUT [48] = {
+	0x200000000000, 0x12E4051D9DF3, 0x09FB385B5EE4, 0x051111D41DDE,
+	0x028B0D430E59, 0x0145D7E15904, 0x00A2F61E5C28, 0x00517C5511D4,
+	0x0028BE5346D1, 0x00145F2EBB31, 0x000A2F980092, 0x000517CC14A8,
+	0x00028BE60CE0, 0x000145F306C1, 0x0000A2F9836B, 0x0000517CC1B7,
+	0x000028BE60DC, 0x0000145F306E, 0x00000A2F9837, 0x00000517CC1B,
+	0x0000028BE60E, 0x00000145F307, 0x000000A2F983, 0x000000517CC2,
+	0x00000028BE61, 0x000000145F30, 0x0000000A2F98, 0x0000000517CC,
+	0x000000028BE6, 0x0000000145F3, 0x00000000A2FA, 0x00000000517D,
+	0x0000000028BE, 0x00000000145F, 0x000000000A30, 0x000000000518,
+	0x00000000028C, 0x000000000146, 0x0000000000A3, 0x000000000051,
+	0x000000000029, 0x000000000014, 0x00000000000A, 0x000000000005,
+	0x000000000003, 0x000000000001, 0x000000000001, 0x000000000000
+};
+
+
+/* ---- Two cascaded DSP48: A (35 bits) x B (nb bits), P = P1[..] & P2[16:0] --- */
+static inline long long mlt35_cascade (
+		long long a,
+		long long b,
+		int nb
+	)
+{
+	long long mlt_a = win_wrap(a, 35);
+	long long mlt_b = win_wrap(b, nb);
+
+	// M2: unsigned 17 LSBs of A, M1: signed 18 MSBs of A //
+	long long dspB_M2 = mlt_a & 0x1FFFF;
+	long long dspB_M1 = mlt_a >> 17;
+
+	long long dspP_M2 = win_wrap(mlt_b * dspB_M2, 48);
+	long long dspP_M1 = win_wrap(mlt_b * dspB_M1 + (dspP_M2 >> 17), 48);
+
+	return win_wrap(((unsigned long long)dspP_M1 << 17) | (dspP_M2 & 0x1FFFF), 35 + nb);
+}
+
+/* ---------------- int_multNxN_dsp48 ---------------- */
+long long dsp48_mult (
+		long long a,
+		long long b,
+		int dtw
+	)
+{
+	return win_wrap(win_wrap(a, dtw) * win_wrap(b, dtw), 2 * dtw);
+}
+
+void dsp48_mult_block (
+		const long long *a,
+		const long long *b,
+		long long count,
+		int dtw,
+		long long *q
+	)
+{
+	long long i;
+	for (i = 0; i < count; i++) {
+		q[i] = win_wrap(win_wrap(a[i], dtw) * win_wrap(b[i], dtw), 2 * dtw);
+	}
+}
+
+/* ---------------- mlt35x25_dsp48e1 ---------------- */
+long long mlt35x25_dsp48e1 (
+		long long a,
+		long long b
+	)
+{
+	return mlt35_cascade(a, b, 25);
+}
+
+void mlt35x25_block (
+		const long long *a,
+		const long long *b,
+		long long count,
+		long long *p
+	)
+{
+	long long i;
+	for (i = 0; i < count; i++) {
+		p[i] = mlt35_cascade(a[i], b[i], 25);
+	}
+}
+
+/* ---------------- mlt35x27_dsp48e2 ---------------- */
+long long mlt35x27_dsp48e2 (
+		long long a,
+		long long b
+	)
+{
+	return mlt35_cascade(a, b, 27);
+}
+
+void mlt35x27_block (
+		const long long *a,
+		const long long *b,
+		long long count,
+		long long *p
+	)
+{
+	long long i;
+	for (i = 0; i < count; i++) {
+		p[i] = mlt35_cascade(a[i], b[i], 27);
+	}
+}
+
+/* ---- DDS48 initial values: init_z, init_x, init_y by quadrant of PH_IN --- */
+static inline void dds48_init (
+		int pw,
+		long long phase,
+		long long *init_x,
+		long long *init_y,
+		long long *init_z
+	)
+{
+	long long ph_in = phase & ((1LL << pw) - 1);
+	long long low = ph_in & ((1LL << (pw - 2)) - 1);
+	int quadrant = (int)(ph_in >> (pw - 2));
+
+	long long init_t;
+	if (quadrant == 0x1) {
+		init_t = low;
+		*init_x = 0;
+		*init_y = win_wrap(-WIN_GAIN48, 48);
+	} else if (quadrant == 0x2) {
+		init_t = low | (0x3LL << (pw - 2));
+		*init_x = 0;
+		*init_y = WIN_GAIN48;
+	} else {
+		init_t = ph_in;
+		*init_x = WIN_GAIN48;
+		*init_y = 0;
+	}
+	*init_z = win_wrap((unsigned long long)init_t << (48 - pw), 48);
+}
+
+/* ---------------- cordic_dds48 ---------------- */
+void dds48_cordic (
+		int phase_width,
+		int data_width,
+		long long phase,
+		long long *out_sin,
+		long long *out_cos
+	)
+{
+	long long x, y, z;
+	dds48_init(phase_width, phase, &x, &y, &z);
+
+	int ii;
+	for (ii = 0; ii < data_width; ii++) {
+		long long dx = y >> ii;
+		long long dy = x >> ii;
+		if (z >= 0) {
+			x = win_wrap(x + dx, 48);
+			y = win_wrap(y - dy, 48);
+			z = win_wrap(z - ROM_LUT[ii], 48);
+		} else {
+			x = win_wrap(x - dx, 48);
+			y = win_wrap(y + dy, 48);
+			z = win_wrap(z + ROM_LUT[ii], 48);
+		}
+	}
+	*out_sin = y >> (48 - data_width);
+	*out_cos = x >> (48 - data_width);
+}
+
+void dds48_block (
+		int phase_width,
+		int data_width,
+		const long long *phase,
+		long long count,
+		long long *out_sin,
+		long long *out_cos
+	)
+{
+	long long x[DDS48_CHUNK];
+	long long y[DDS48_CHUNK];
+	long long z[DDS48_CHUNK];
+
+	long long base;
+	for (base = 0; base < count; base += DDS48_CHUNK) {
+		int num = (count - base < DDS48_CHUNK) ? (int)(count - base) : DDS48_CHUNK;
+
+		int j;
+		for (j = 0; j < num; j++) {
+			dds48_init(phase_width, phase[base + j], &x[j], &y[j], &z[j]);
+		}
+
+		// Stage-major: mask is 0 for z >= 0 and -1 for z < 0, (v ^ m) - m = +/-v //
+		int ii;
+		for (ii = 0; ii < data_width; ii++) {
+			const long long rom = ROM_LUT[ii];
+			for (j = 0; j < num; j++) {
+				long long msk = z[j] >> 63;
+				long long dx = y[j] >> ii;
+				long long dy = x[j] >> ii;
+				x[j] = win_wrap(x[j] + ((dx ^ msk) - msk), 48);
+				y[j] = win_wrap(y[j] - ((dy ^ msk) - msk), 48);
+				z[j] = win_wrap(z[j] - ((rom ^ msk) - msk), 48);
+			}
+		}
+
+		for (j = 0; j < num; j++) {
+			out_sin[base + j] = y[j] >> (48 - data_width);
+			out_cos[base + j] = x[j] >> (48 - data_width);
+		}
+	}
+}
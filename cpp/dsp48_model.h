@@ -0,0 +1,116 @@
+/*******************************************************************************
+--
+-- Title       : dsp48_model.h
+-- Design      : Bit-true models of DSP48 multipliers and CORDIC DDS48
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Native emulation of int_multNxN_dsp48.vhd, mults/mlt35x25_dsp48e1.vhd,
+--               mults/mlt35x27_dsp48e2.vhd and the 48-bit datapath of cordic_dds48.vhd.
+--               Results are bit-exact with RTL outputs; latency (clocks) is given by
+--               *_DELAY constants. Block functions process arrays of samples.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef DSP48_MODEL_H
+#define DSP48_MODEL_H
+
+/* ---- Latency of RTL cores, clocks from input to output --- */
+#define MULT_NXN_DELAY 2
+#define MLT35_DELAY    4
+#define DDS48_DELAY(dw) ((dw) + 3)
+
+/* ---- Samples per stage-major pass of DDS48 block --- */
+#define DDS48_CHUNK    256
+
+/* ---- int_multNxN_dsp48: Q = A * B, DTW up to 32 bits --- */
+long long dsp48_mult (
+	long long a,
+	long long b,
+	int dtw
+);
+
+void dsp48_mult_block (
+	const long long *a,
+	const long long *b,
+	long long count,
+	int dtw,
+	long long *q
+);
+
+/* ---- mlt35x25_dsp48e1: 35x25 by two cascaded DSP48E1, 60-bit P --- */
+long long mlt35x25_dsp48e1 (
+	long long a,
+	long long b
+);
+
+void mlt35x25_block (
+	const long long *a,
+	const long long *b,
+	long long count,
+	long long *p
+);
+
+/* ---- mlt35x27_dsp48e2: 35x27 by two cascaded DSP48E2, 62-bit P --- */
+long long mlt35x27_dsp48e2 (
+	long long a,
+	long long b
+);
+
+void mlt35x27_block (
+	const long long *a,
+	const long long *b,
+	long long count,
+	long long *p
+);
+
+/* ---- cordic_dds48: sine and cosine of phase PH_IN (PHASE_WIDTH bits) --- */
+void dds48_cordic (
+	int phase_width,
+	int data_width,
+	long long phase,
+	long long *out_sin,
+	long long *out_cos
+);
+
+void dds48_block (
+	int phase_width,
+	int data_width,
+	const long long *phase,
+	long long count,
+	long long *out_sin,
+	long long *out_cos
+);
+
+#endif
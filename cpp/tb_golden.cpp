@@ -0,0 +1,518 @@
+/*******************************************************************************
+--
+-- Title       : tb_golden.cpp
+-- Design      : Golden vectors for VHDL testbench matrix
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Generate expected DT_WIN of win_selector (bit-exact cpp/vhd_model) for every
+--               combination of PHI_WIDTH, DAT_WIDTH, WIN_TYPE, SIN_TYPE, LUT_SIZE and
+--               XSERIES. Configurations are computed in parallel; file name is FNV-1a hash
+--               of normalized generics, so equal outputs share one file and files which
+--               exist are not computed again (-f: compute all).
+--               
+--               Usage: tb_golden [-o dir] [-p 8:12] [-d 12:24] [-w all] [-s all]
+--                                [-l 10] [-x all] [-t threads] [-f]
+--               Lists: 'all', range 'a:b' or comma list: -w HAMMING,BH7TERM -s TAYLOR
+--               Example: tb_golden -o golden -p 8:14 -d 16:24
+--               
+--               File (little-endian): "WGLD", VHD_VERSION, PHI_WIDTH, DAT_WIDTH, WIN_TYPE,
+--               SIN_TYPE, LUT_SIZE, XSERIES, number of samples, bytes per sample, AA0..AA6
+--               (int32) and DT_WIN samples. index.txt: generics of each point and its file.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <atomic>
+#include <thread>
+
+#include "vhd_model.h"
+
+/* ---- Golden file header: magic + 16 words --- */
+#define GLD_MAGIC  "WGLD"
+#define GLD_WORDS  16
+
+/* ---- Path buffer: dir + "/" + 16 hex digits + ".bin.tmp" fits in it --- */
+#define GLD_PATH   1024
+
+/* ---- Largest PHI_WIDTH: COUNT of header is int, file is read to memory --- */
+#define GLD_MAXPHI 30
+
+/* ---- Maximum number of values in list of generics --- */
+#define LIST_MAX   64
+
+typedef struct {
+	vhd_cfg_t cfg;         // generics of matrix point
+	vhd_cfg_t key;         // normalized generics
+	unsigned long long hash;
+	int first;             // 1 - point computes the file
+} point_t;
+
+/* ---- FNV-1a 64-bit --- */
+static unsigned long long fnv1a (
+		unsigned long long hash,
+		int val
+	)
+{
+	int i;
+	for (i = 0; i < 4; i++) {
+		hash ^= (unsigned long long)((val >> (8 * i)) & 0xFF);
+		hash *= 0x100000001B3ULL;
+	}
+	return hash;
+}
+
+static unsigned long long cfg_hash (
+		const vhd_cfg_t *key
+	)
+{
+	unsigned long long hash = 0xCBF29CE484222325ULL;
+	hash = fnv1a(hash, VHD_VERSION);
+	hash = fnv1a(hash, key->phi_width);
+	hash = fnv1a(hash, key->dat_width);
+	hash = fnv1a(hash, key->win_type);
+	hash = fnv1a(hash, key->sin_type);
+	hash = fnv1a(hash, key->lut_size);
+	hash = fnv1a(hash, key->xseries);
+	return hash;
+}
+
+static void put_word (
+		unsigned char *buf,
+		long long val,
+		int bytes
+	)
+{
+	int i;
+	for (i = 0; i < bytes; i++) {
+		buf[i] = (unsigned char)((val >> (8 * i)) & 0xFF);
+	}
+}
+
+static void gld_header (
+		const vhd_cfg_t *key,
+		const long long *aa,
+		int *hdr
+	)
+{
+	hdr[0] = VHD_VERSION;
+	hdr[1] = key->phi_width;
+	hdr[2] = key->dat_width;
+	hdr[3] = key->win_type;
+	hdr[4] = key->sin_type;
+	hdr[5] = key->lut_size;
+	hdr[6] = key->xseries;
+	hdr[7] = (int)(1LL << key->phi_width);
+	hdr[8] = (key->dat_width + 7) / 8;
+
+	int k;
+	for (k = 0; k < WIN_MAXTERM; k++) {
+		hdr[9 + k] = (int)aa[k];
+	}
+}
+
+/* ---- 0 - file exists and has the same header --- */
+static int gld_cached (
+		const char *fname,
+		const int *hdr
+	)
+{
+	FILE *fin = fopen(fname, "rb");
+	if (!fin) {
+		return 1;
+	}
+
+	unsigned char buf[4 + 4 * GLD_WORDS];
+	int ret = (fread(buf, 1, sizeof(buf), fin) == sizeof(buf)) ? 0 : 1;
+	if ((ret == 0) && memcmp(buf, GLD_MAGIC, 4)) {
+		ret = 1;
+	}
+
+	int i;
+	for (i = 0; (ret == 0) && (i < GLD_WORDS); i++) {
+		unsigned char word[4];
+		put_word(word, hdr[i], 4);
+		ret = memcmp(&buf[4 + 4 * i], word, 4) ? 1 : 0;
+	}
+
+	// Check file size: header + samples //
+	if (ret == 0) {
+		long long size = 4 + 4 * GLD_WORDS + (long long)hdr[7] * hdr[8];
+		fseek(fin, 0, SEEK_END);
+		ret = (ftell(fin) == size) ? 0 : 1;
+	}
+	fclose(fin);
+	return ret;
+}
+
+static int gld_write (
+		const char *fname,
+		const vhd_cfg_t *key
+	)
+{
+	long long aa[WIN_MAXTERM];
+	int hdr[GLD_WORDS];
+	vhd_coeffs(key, aa);
+	gld_header(key, aa, hdr);
+
+	const long long nsamples = hdr[7];
+	const int bytes = hdr[8];
+
+	unsigned char *buf = (unsigned char *)malloc(4 + 4 * GLD_WORDS + nsamples * bytes);
+	long long *win = (long long *)malloc(nsamples * sizeof(long long));
+	if (!buf || !win) {
+		free(win);
+		free(buf);
+		return 1;
+	}
+
+	memcpy(buf, GLD_MAGIC, 4);
+	int i;
+	for (i = 0; i < GLD_WORDS; i++) {
+		put_word(&buf[4 + 4 * i], hdr[i], 4);
+	}
+
+	vhd_window_block(key, aa, 0, nsamples, win);
+
+	unsigned char *dat = &buf[4 + 4 * GLD_WORDS];
+	long long n;
+	for (n = 0; n < nsamples; n++) {
+		put_word(&dat[n * bytes], win[n], bytes);
+	}
+
+	// Write to temporary file: other process never sees part of file //
+	char tname[GLD_PATH + 4];
+	if (snprintf(tname, sizeof(tname), "%s.tmp", fname) >= (int)sizeof(tname)) {
+		free(win);
+		free(buf);
+		return 1;
+	}
+
+	int ret = 1;
+	FILE *fout = fopen(tname, "wb");
+	if (fout) {
+		size_t size = 4 + 4 * GLD_WORDS + nsamples * bytes;
+		ret = (fwrite(buf, 1, size, fout) == size) ? 0 : 1;
+		ret |= fclose(fout) ? 1 : 0;
+		if (ret == 0) {
+			ret = rename(tname, fname) ? 1 : 0;
+		}
+	}
+
+	free(win);
+	free(buf);
+	return ret;
+}
+
+/* ---- Parse list of integers: 'a:b' or 'a,b,c' --- */
+static int parse_int (
+		const char *str,
+		int *list
+	)
+{
+	int num = 0;
+	int lo, hi;
+	if ((strchr(str, ':') != NULL) && (sscanf(str, "%d:%d", &lo, &hi) == 2)) {
+		for (; (lo <= hi) && (num < LIST_MAX); lo++) {
+			list[num++] = lo;
+		}
+		return num;
+	}
+	const char *ptr = str;
+	while (*ptr && (num < LIST_MAX)) {
+		list[num++] = atoi(ptr);
+		ptr = strchr(ptr, ',');
+		if (!ptr) {
+			break;
+		}
+		ptr++;
+	}
+	return num;
+}
+
+/* ---- Parse list of names: 'all' or 'A,B,C' --- */
+static int parse_str (
+		const char *str,
+		int *list,
+		int nall,
+		const int *all,
+		int (*select)(const char *)
+	)
+{
+	if (strcmp(str, "all") == 0) {
+		memcpy(list, all, nall * sizeof(int));
+		return nall;
+	}
+
+	int num = 0;
+	char name[64];
+	const char *ptr = str;
+	while (*ptr && (num < LIST_MAX)) {
+		size_t len = strcspn(ptr, ",");
+		if (len >= sizeof(name)) {
+			len = sizeof(name) - 1;
+		}
+		memcpy(name, ptr, len);
+		name[len] = 0;
+		int val = select(name);
+		if (val < 0) {
+			printf("FAIL: unknown value %s\n", name);
+			return 0;
+		}
+		list[num++] = val;
+		ptr += len;
+		if (*ptr == ',') {
+			ptr++;
+		}
+	}
+	return num;
+}
+
+static int type_select (
+		const char *name
+	)
+{
+	int type = vhd_win_select(name);
+	return (type == WIN_EMPTY) ? -1 : type;
+}
+
+static int sine_select (
+		const char *name
+	)
+{
+	if (strcmp(name, vhd_sin_name(VHD_CORDIC)) == 0) {
+		return VHD_CORDIC;
+	}
+	if (strcmp(name, vhd_sin_name(VHD_TAYLOR)) == 0) {
+		return VHD_TAYLOR;
+	}
+	return -1;
+}
+
+static int xseries_select (
+		const char *name
+	)
+{
+	if (strcmp(name, vhd_xseries_name(VHD_7SERIES)) == 0) {
+		return VHD_7SERIES;
+	}
+	if (strcmp(name, vhd_xseries_name(VHD_ULTRA)) == 0) {
+		return VHD_ULTRA;
+	}
+	return -1;
+}
+
+int main (int argc, char **argv) {
+
+	static const int all_win[] = { WIN_HAMMING, WIN_BH3, WIN_BH4, WIN_BH5, WIN_BH7 };
+	static const int all_sin[] = { VHD_CORDIC, VHD_TAYLOR };
+	static const int all_xsr[] = { VHD_7SERIES, VHD_ULTRA };
+
+	const char *dir = "golden";
+	int lst_phi[LIST_MAX], num_phi = parse_int("8:12", lst_phi);
+	int lst_dat[LIST_MAX], num_dat = parse_int("12:24", lst_dat);
+	int lst_lut[LIST_MAX], num_lut = parse_int("10", lst_lut);
+	int lst_win[LIST_MAX], num_win = parse_str("all", lst_win, 5, all_win, type_select);
+	int lst_sin[LIST_MAX], num_sin = parse_str("all", lst_sin, 2, all_sin, sine_select);
+	int lst_xsr[LIST_MAX], num_xsr = parse_str("all", lst_xsr, 2, all_xsr, xseries_select);
+
+	int nthreads = std::thread::hardware_concurrency();
+	int force = 0;
+
+	int i;
+	for (i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-f") == 0) {
+			force = 1;
+			continue;
+		}
+		if (i + 1 >= argc) {
+			printf("Usage: %s [-o dir] [-p 8:12] [-d 12:24] [-w all] [-s all] [-l 10] [-x all] [-t threads] [-f]\n", argv[0]);
+			return 1;
+		}
+		const char *val = argv[++i];
+		if (strcmp(argv[i-1], "-o") == 0) {
+			dir = val;
+		} else if (strcmp(argv[i-1], "-p") == 0) {
+			num_phi = parse_int(val, lst_phi);
+		} else if (strcmp(argv[i-1], "-d") == 0) {
+			num_dat = parse_int(val, lst_dat);
+		} else if (strcmp(argv[i-1], "-l") == 0) {
+			num_lut = parse_int(val, lst_lut);
+		} else if (strcmp(argv[i-1], "-w") == 0) {
+			num_win = parse_str(val, lst_win, 5, all_win, type_select);
+		} else if (strcmp(argv[i-1], "-s") == 0) {
+			num_sin = parse_str(val, lst_sin, 2, all_sin, sine_select);
+		} else if (strcmp(argv[i-1], "-x") == 0) {
+			num_xsr = parse_str(val, lst_xsr, 2, all_xsr, xseries_select);
+		} else if (strcmp(argv[i-1], "-t") == 0) {
+			nthreads = atoi(val);
+		}
+	}
+	if (nthreads < 1) {
+		nthreads = 1;
+	}
+	if (!num_phi || !num_dat || !num_lut || !num_win || !num_sin || !num_xsr) {
+		printf("FAIL: empty list of generics\n");
+		return 1;
+	}
+	for (i = 0; i < num_phi; i++) {
+		if (lst_phi[i] > GLD_MAXPHI) {
+			printf("FAIL: PHI_WIDTH of golden file must not exceed %d\n", GLD_MAXPHI);
+			return 1;
+		}
+	}
+
+	if (strlen(dir) + 32 > GLD_PATH) {
+		printf("FAIL: output directory name is too long\n");
+		return 1;
+	}
+	mkdir(dir, 0755);
+
+	// Matrix of configurations: skip unsupported, share files of equal outputs //
+	int npts = num_phi * num_dat * num_lut * num_win * num_sin * num_xsr;
+	point_t *pts = (point_t *)malloc(npts * sizeof(point_t));
+
+	int p, d, l, w, s, x, n = 0, nskip = 0;
+	for (p = 0; p < num_phi; p++)
+	for (d = 0; d < num_dat; d++)
+	for (w = 0; w < num_win; w++)
+	for (s = 0; s < num_sin; s++)
+	for (l = 0; l < num_lut; l++)
+	for (x = 0; x < num_xsr; x++) {
+		point_t *pt = &pts[n];
+		pt->cfg.phi_width = lst_phi[p];
+		pt->cfg.dat_width = lst_dat[d];
+		pt->cfg.win_type = lst_win[w];
+		pt->cfg.sin_type = lst_sin[s];
+		pt->cfg.lut_size = (lst_sin[s] == VHD_TAYLOR) ? lst_lut[l] : 0;
+		pt->cfg.xseries = lst_xsr[x];
+		if (vhd_check(&pt->cfg)) {
+			nskip++;
+			continue;
+		}
+		pt->key = pt->cfg;
+		vhd_normalize(&pt->key);
+		pt->hash = cfg_hash(&pt->key);
+
+		// LUT_SIZE is not used by CORDIC: one point for all values //
+		int k;
+		for (k = 0; k < n; k++) {
+			if (memcmp(&pts[k].cfg, &pt->cfg, sizeof(vhd_cfg_t)) == 0) {
+				break;
+			}
+		}
+		if (k < n) {
+			continue;
+		}
+		pt->first = 1;
+		for (k = 0; k < n; k++) {
+			if (pts[k].hash == pt->hash) {
+				pt->first = 0;
+				break;
+			}
+		}
+		n++;
+	}
+	npts = n;
+
+	// Work items: one file for each unique configuration //
+	std::atomic<int> next(0);
+	std::atomic<int> ndone(0);
+	std::atomic<int> ncache(0);
+	std::atomic<int> nfail(0);
+	std::thread *pool = new std::thread[nthreads];
+
+	for (i = 0; i < nthreads; i++) {
+		pool[i] = std::thread([&]() {
+			for (;;) {
+				int idx = next++;
+				if (idx >= npts) {
+					break;
+				}
+				if (!pts[idx].first) {
+					continue;
+				}
+				char fname[GLD_PATH];
+				snprintf(fname, sizeof(fname), "%s/%016llx.bin", dir, pts[idx].hash);
+
+				long long aa[WIN_MAXTERM];
+				int hdr[GLD_WORDS];
+				vhd_coeffs(&pts[idx].key, aa);
+				gld_header(&pts[idx].key, aa, hdr);
+				if (!force && (gld_cached(fname, hdr) == 0)) {
+					ncache++;
+					continue;
+				}
+				if (gld_write(fname, &pts[idx].key)) {
+					printf("FAIL: cannot write %s\n", fname);
+					nfail++;
+					continue;
+				}
+				ndone++;
+			}
+		});
+	}
+	for (i = 0; i < nthreads; i++) {
+		pool[i].join();
+	}
+	delete[] pool;
+
+	// Index: generics of win_selector and golden file //
+	char iname[GLD_PATH];
+	snprintf(iname, sizeof(iname), "%s/index.txt", dir);
+	FILE *fidx = fopen(iname, "w");
+	if (!fidx) {
+		printf("FAIL: cannot open %s\n", iname);
+		free(pts);
+		return 1;
+	}
+	fprintf(fidx, "# PHI_WIDTH DAT_WIDTH WIN_TYPE SIN_TYPE LUT_SIZE XSERIES FILE\n");
+	for (n = 0; n < npts; n++) {
+		const vhd_cfg_t *cfg = &pts[n].cfg;
+		fprintf(fidx, "%d %d %s %s %d %s %016llx.bin\n",
+			cfg->phi_width, cfg->dat_width, vhd_win_name(cfg->win_type), vhd_sin_name(cfg->sin_type),
+			cfg->lut_size, vhd_xseries_name(cfg->xseries), pts[n].hash);
+	}
+	fclose(fidx);
+
+	printf("%d points (%d unsupported), %d computed, %d cached on %d threads: %s\n",
+		npts, nskip, ndone.load(), ncache.load(), nthreads, iname);
+
+	free(pts);
+	return nfail.load() ? 1 : 0;
+}
@@ -0,0 +1,488 @@
+/*******************************************************************************
+--
+-- Title       : vhd_model.cpp
+-- Design      : Bit-exact model of VHDL window cores
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Native model of win_selector: hamming_win, bh_win_3term, 4term, 5term,
+--               7term with cordic_dds or taylor_sincos sine generators.
+--               
+--               Every signal is wrapped to the width of its std_logic_vector, products
+--               go through bit-true DSP48 models (cpp/dsp48_model). Taylor engine:
+--               DATA_WIDTH < 19 - one DSP48 per output (C -/+ A*B, floor), otherwise
+--               35x25 / 35x27 multipliers, subtraction and saturation of negative
+--               results (tay1_order.vhd).
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <string.h>
+#include <math.h>
+#include "vhd_model.h"
+#include "dsp48_model.h"
+#include "win_tables.h"
+
+/* ---- Gain 1/K * 2^47 and PRECISION of cordic_dds in window cores
+	(look-up table and wrap are WIN_LUT48 and win_wrap of win_tables.h) --- */
+static const long long GAIN48 = 0x4DBA76D421AF;
+#define VHD_PREC 1
+
+/* ---- Generic strings --- */
+static const struct {
+	int type;
+	const char *name;
+} vhd_table[] = {
+	{ WIN_HAMMING, "HAMMING" },
+	{ WIN_BH3,     "BH3TERM" },
+	{ WIN_BH4,     "BH4TERM" },
+	{ WIN_BH5,     "BH5TERM" },
+	{ WIN_BH7,     "BH7TERM" },
+};
+
+#define VHD_NTYPES (int)(sizeof(vhd_table) / sizeof(vhd_table[0]))
+
+/* ---- Round from N+1 to N bits: X(N downto 1) + X(0) --- */
+static inline long long rnd1 (
+		long long val,
+		int bits
+	)
+{
+	return win_wrap((val >> 1) + (val & 1), bits);
+}
+
+/* ---- Round from N+2 to N bits: X(N+1 downto 2) + X(1) --- */
+static inline long long rnd2 (
+		long long val,
+		int bits
+	)
+{
+	return win_wrap((val >> 2) + ((val >> 1) & 1), bits);
+}
+
+const char *vhd_win_name (
+		int win_type
+	)
+{
+	int i;
+	for (i = 0; i < VHD_NTYPES; i++) {
+		if (vhd_table[i].type == win_type) {
+			return vhd_table[i].name;
+		}
+	}
+	return "NONE";
+}
+
+int vhd_win_select (
+		const char *name
+	)
+{
+	int i;
+	for (i = 0; i < VHD_NTYPES; i++) {
+		if (strcmp(vhd_table[i].name, name) == 0) {
+			return vhd_table[i].type;
+		}
+	}
+	return WIN_EMPTY;
+}
+
+const char *vhd_sin_name (
+		int sin_type
+	)
+{
+	return (sin_type == VHD_TAYLOR) ? "TAYLOR" : "CORDIC";
+}
+
+const char *vhd_xseries_name (
+		int xseries
+	)
+{
+	return (xseries == VHD_7SERIES) ? "7SERIES" : "ULTRA";
+}
+
+/* ---- Taylor engine limits: ROM address, tay1_order STAGE and XSHIFT slices --- */
+static int taylor_check (
+		int pw,
+		int dw,
+		int lut
+	)
+{
+	if ((lut < 2) || (pw < 3)) {
+		return 1;
+	}
+	if (pw - lut > 2) {
+		int stage = pw - lut - 3;
+		int xshift = 19 + lut;
+		if (stage > 15) {
+			return 1;
+		}
+		if ((dw < 19) && (xshift + dw > 48)) {
+			return 1;
+		}
+		// DSP48E1 cascade drives MLT_P(59 downto 0) only //
+		if ((dw >= 19) && ((xshift + dw > 60) || (dw > 35))) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int vhd_check (
+		const vhd_cfg_t *cfg
+	)
+{
+	if (vhd_win_select(vhd_win_name(cfg->win_type)) == WIN_EMPTY) {
+		return 1;
+	}
+	if ((cfg->phi_width < 4) || (cfg->phi_width > 32) || (cfg->dat_width < 8) || (cfg->dat_width > 32)) {
+		return 1;
+	}
+	if ((cfg->sin_type == VHD_TAYLOR) && ((cfg->win_type == WIN_HAMMING) || (cfg->win_type == WIN_BH3))) {
+		if (taylor_check(cfg->phi_width, cfg->dat_width, cfg->lut_size)) {
+			return 1;
+		}
+		if ((cfg->win_type == WIN_BH3) && taylor_check(cfg->phi_width - 1, cfg->dat_width, cfg->lut_size)) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+void vhd_normalize (
+		vhd_cfg_t *cfg
+	)
+{
+	// SIN_TYPE is used by hamming_win and bh_win_3term only //
+	if ((cfg->win_type != WIN_HAMMING) && (cfg->win_type != WIN_BH3)) {
+		cfg->sin_type = VHD_CORDIC;
+	}
+	if (cfg->sin_type == VHD_CORDIC) {
+		cfg->lut_size = 0;
+	}
+	// Both DSP48E1 and DSP48E2 multipliers are exact for Taylor operands //
+	cfg->xseries = VHD_7SERIES;
+}
+
+int vhd_coeffs (
+		const vhd_cfg_t *cfg,
+		long long *aa
+	)
+{
+	static const double cnt2[] = { 0.5434783, 1.0 - 0.5434783 };
+	static const double cnt3[] = { 0.42, 0.5, 0.08 };
+	static const double cnt4[] = { 0.35875, 0.48829, 0.14128, 0.01168 };
+	static const double cnt5[] = { 1.000, 1.930, 1.290, 0.388, 0.030 };
+	static const double cnt7[] = { 0.271220360585039, 0.433444612327442, 0.218004122892930,
+	                               0.065785343295606, 0.010761867305342, 0.000770012710581,
+	                               0.000013680883060 };
+
+	const int w = cfg->dat_width;
+	const double *coe;
+	double scale;
+	int nterm;
+
+	switch (cfg->win_type) {
+		case WIN_HAMMING: coe = cnt2; nterm = 2; scale = pow(2.0, w-1) - 1.0;  break;
+		case WIN_BH3:     coe = cnt3; nterm = 3; scale = pow(2.0, w) - 16.0;   break;
+		case WIN_BH4:     coe = cnt4; nterm = 4; scale = pow(2.0, w) - 1.0;    break;
+		case WIN_BH5:     coe = cnt5; nterm = 5; scale = pow(2.0, w-2) - 1.0;  break;
+		case WIN_BH7:     coe = cnt7; nterm = 7; scale = pow(2.0, w-1) - 1.0;  break;
+		default:          coe = NULL; nterm = 0; scale = 0.0; break;
+	}
+
+	int k;
+	for (k = 0; k < WIN_MAXTERM; k++) {
+		aa[k] = (k < nterm) ? win_wrap((long long)round(coe[k] * scale), w) : 0;
+	}
+	return nterm;
+}
+
+/* ---------------- cordic_dds ---------------- */
+void vhd_cordic (
+		int phase_width,
+		int data_width,
+		long long phase,
+		long long *out_cos,
+		long long *out_sin
+	)
+{
+	const int pw = phase_width;
+	const int dw = data_width + VHD_PREC;
+
+	long long ph_in = phase & ((1LL << pw) - 1);
+	int quadrant = (int)(ph_in >> (pw - 2));
+
+	// init_t = "00" & PH_IN(PW-3 downto 0) //
+	long long init_t = ph_in & ((1LL << (pw - 2)) - 1);
+	long long z;
+	if (pw >= data_width) {
+		z = (init_t >> (pw - data_width)) << VHD_PREC;
+	} else {
+		z = init_t << (data_width - pw + VHD_PREC);
+	}
+	z = win_wrap(z, dw);
+
+	long long x = GAIN48 >> (48 - dw + 1);
+	long long y = 0;
+
+	int ii;
+	for (ii = 0; ii < data_width - 1; ii++) {
+		long long dx = y >> ii;
+		long long dy = x >> ii;
+		long long rom = WIN_LUT48[ii] >> (48 - (dw - 1));
+		if (z < 0) {
+			x = win_wrap(x + dx, dw);
+			y = win_wrap(y - dy, dw);
+			z = win_wrap(z + rom, dw);
+		} else {
+			x = win_wrap(x - dx, dw);
+			y = win_wrap(y + dy, dw);
+			z = win_wrap(z - rom, dw);
+		}
+	}
+
+	long long dat_cos = x >> VHD_PREC;
+	long long dat_sin = y >> VHD_PREC;
+
+	switch (quadrant) {
+		case 0x0: *out_sin = dat_sin;                       *out_cos = dat_cos; break;
+		case 0x1: *out_sin = dat_cos;                       *out_cos = win_wrap(-dat_sin, data_width); break;
+		case 0x2: *out_sin = win_wrap(-dat_sin, data_width);    *out_cos = win_wrap(-dat_cos, data_width); break;
+		default:  *out_sin = win_wrap(-dat_cos, data_width);    *out_cos = dat_sin; break;
+	}
+}
+
+/* ---------------- taylor_sincos ---------------- */
+void vhd_taylor (
+		int phase_width,
+		int data_width,
+		int lut_size,
+		long long phase,
+		long long *out_cos,
+		long long *out_sin
+	)
+{
+	const int pw = phase_width;
+	const int dw = data_width;
+
+	long long cnt = phase & ((1LL << pw) - 1);
+	int quadrant = (int)(cnt >> (pw - 2));
+
+	long long addr;
+	long long acnt = 0;
+	if (pw - lut_size < 2) {
+		addr = (cnt & ((1LL << (pw - 2)) - 1)) << (lut_size - pw + 2);
+	} else if (pw - lut_size == 2) {
+		addr = cnt & ((1LL << lut_size) - 1);
+	} else {
+		addr = (cnt >> (pw - lut_size - 2)) & ((1LL << lut_size) - 1);
+		acnt = cnt & ((1LL << (pw - lut_size - 2)) - 1);
+	}
+
+	// ROM: INTEGER((2^(DW-1)-1) * cos / sin) //
+	double phi = (addr * M_PI) / (2.0 * (1LL << lut_size));
+	long long mem_cos = win_wrap((long long)round((pow(2.0, dw-1) - 1.0) * cos(phi)), dw);
+	long long mem_sin = win_wrap((long long)round((pow(2.0, dw-1) - 1.0) * sin(phi)), dw);
+
+	// 1st order Taylor series (tay1_order) //
+	if (pw - lut_size > 2) {
+		const int stage = pw - lut_size - 3;
+		const int xshift = 19 + lut_size;
+		const long long ramb_pi = (long long)round(M_PI * pow(2.0, 17 - stage));
+		const long long mpx = (ramb_pi * acnt) & 0xFFFFFF;
+
+		if (dw < 19) {
+			// DSP48: P = C -/+ A*B, C = ROM << XSHIFT //
+			long long cos_prod = win_wrap(win_wrap(mem_cos << xshift, 48) - mpx * mem_sin, 48);
+			long long sin_prod = win_wrap(win_wrap(mem_sin << xshift, 48) + mpx * mem_cos, 48);
+			mem_cos = win_wrap(cos_prod >> xshift, dw);
+			mem_sin = win_wrap(sin_prod >> xshift, dw);
+		} else {
+			// 35x25 and 35x27 products are equal below bit 60 (vhd_check) //
+			long long cos_pp = mlt35x27_dsp48e2(mem_cos, mpx);
+			long long sin_pp = mlt35x27_dsp48e2(mem_sin, mpx);
+
+			long long mlt1_bb = win_wrap(sin_pp >> xshift, dw);
+			long long mlt2_bb = win_wrap(cos_pp >> xshift, dw);
+
+			long long cos_pdt = win_wrap(mem_cos - mlt1_bb, dw);
+			long long sin_pdt = win_wrap(mem_sin + mlt2_bb, dw);
+
+			// Negative result is replaced by maximum value //
+			mem_cos = (cos_pdt < 0) ? (1LL << (dw - 1)) - 1 : cos_pdt;
+			mem_sin = (sin_pdt < 0) ? (1LL << (dw - 1)) - 1 : sin_pdt;
+		}
+	}
+
+	switch (quadrant) {
+		case 0x0: *out_sin = mem_sin;               *out_cos = mem_cos; break;
+		case 0x1: *out_sin = mem_cos;               *out_cos = win_wrap(-mem_sin, dw); break;
+		case 0x2: *out_sin = win_wrap(-mem_sin, dw);    *out_cos = win_wrap(-mem_cos, dw); break;
+		default:  *out_sin = win_wrap(-mem_cos, dw);    *out_cos = mem_sin; break;
+	}
+}
+
+/* ---- Cosine of harmonic m for phase of the first harmonic --- */
+static long long vhd_harmonic (
+		const vhd_cfg_t *cfg,
+		int m,
+		long long phase
+	)
+{
+	long long c, s;
+	if (cfg->sin_type == VHD_TAYLOR) {
+		// bh_win_3term: 2nd harmonic by taylor_sincos of PHI_WIDTH-1 //
+		int pw = cfg->phi_width - (m - 1);
+		vhd_taylor(pw, cfg->dat_width, cfg->lut_size, phase, &c, &s);
+	} else {
+		vhd_cordic(cfg->phi_width, cfg->dat_width, m * phase, &c, &s);
+	}
+	return c;
+}
+
+/* ---------------- Window cores ---------------- */
+int vhd_sine_delay (
+		const vhd_cfg_t *cfg,
+		int m
+	)
+{
+	if ((cfg->sin_type != VHD_TAYLOR) || ((cfg->win_type != WIN_HAMMING) && (cfg->win_type != WIN_BH3))) {
+		// cordic_dds: init_z, DATA_WIDTH-1 iterations, output register //
+		return cfg->dat_width + 1;
+	}
+
+	// taylor_sincos: counter, addr, ROM, tay1_order, mem, output //
+	int pw = cfg->phi_width - (m - 1);
+	if (pw - cfg->lut_size <= 2) {
+		return 4;
+	}
+	return (cfg->dat_width < 19) ? 7 : 10;
+}
+
+long long vhd_window_at (
+		const vhd_cfg_t *cfg,
+		const long long *aa,
+		const long long *phase
+	)
+{
+	const int w = cfg->dat_width;
+
+	vhd_cfg_t crd = *cfg;
+	if ((cfg->win_type != WIN_HAMMING) && (cfg->win_type != WIN_BH3)) {
+		crd.sin_type = VHD_CORDIC;
+	}
+
+	// DSP48: mult_p = AA * cos, dsp_r = P(2W-2 downto W-2), dsp_b = round //
+	long long b[WIN_MAXTERM];
+	b[0] = win_wrap(aa[0], w);
+
+	int nterm = (cfg->win_type == WIN_HAMMING) ? 2 : cfg->win_type;
+	int k;
+	for (k = 1; k < nterm; k++) {
+		long long c = vhd_harmonic(&crd, k, phase[k]);
+		long long p = dsp48_mult(aa[k], c, w);
+		long long r = win_wrap(p >> (w - 2), w + 1);
+		b[k] = rnd1(r, w);
+	}
+
+	long long pp;
+	switch (cfg->win_type) {
+		case WIN_HAMMING:
+			pp = win_wrap(b[0] - b[1], w + 1);
+			return rnd1(pp, w);
+
+		case WIN_BH3:
+			pp = win_wrap(b[2] - b[1] + b[0], w + 2);
+			return rnd2(pp, w);
+
+		case WIN_BH4: {
+			long long p1 = win_wrap(b[2] - b[3], w + 1);
+			long long p2 = win_wrap(b[0] - b[1], w + 1);
+			pp = win_wrap(p1 + p2, w + 2);
+			return rnd2(pp, w);
+		}
+
+		case WIN_BH5: {
+			long long p1 = win_wrap(b[4] - b[3] + b[2], w + 2);
+			long long p2 = win_wrap(b[0] - b[1], w + 2);
+			pp = win_wrap(p1 + p2, w + 2);
+			return rnd2(pp, w);
+		}
+
+		case WIN_BH7: {
+			long long p1 = win_wrap(b[0] - b[1], w + 2);
+			long long p2 = win_wrap(b[2] - b[3], w + 2);
+			long long p3 = win_wrap(b[4] - b[5], w + 2);
+			long long q1 = win_wrap(p1 + p2, w + 2);
+			long long q2 = win_wrap(p3 + b[6], w + 2);
+			pp = win_wrap(q1 + q2, w + 2);
+			return rnd2(pp, w);
+		}
+
+		default:
+			return 0;
+	}
+}
+
+long long vhd_window (
+		const vhd_cfg_t *cfg,
+		const long long *aa,
+		long long phase
+	)
+{
+	// Harmonic generators with shorter delay see later counter values //
+	const int d1 = vhd_sine_delay(cfg, 1);
+	long long hphase[WIN_MAXTERM];
+
+	int k;
+	for (k = 1; k < WIN_MAXTERM; k++) {
+		hphase[k] = phase + (d1 - vhd_sine_delay(cfg, k));
+	}
+	return vhd_window_at(cfg, aa, hphase);
+}
+
+void vhd_window_block (
+		const vhd_cfg_t *cfg,
+		const long long *aa,
+		long long start,
+		long long count,
+		long long *out
+	)
+{
+	const long long mask = (1LL << cfg->phi_width) - 1;
+
+	long long i;
+	for (i = 0; i < count; i++) {
+		out[i] = vhd_window(cfg, aa, (start + i + VHD_PHASE0) & mask);
+	}
+}
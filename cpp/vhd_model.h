@@ -0,0 +1,157 @@
+/*******************************************************************************
+--
+-- Title       : vhd_model.h
+-- Design      : Bit-exact model of VHDL window cores
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Native model of win_selector: hamming_win, bh_win_3term, 4term, 5term,
+--               7term with cordic_dds or taylor_sincos sine generators. Output sample n
+--               (n-th DT_VLD after reset) is the window at phase n+1 (phase counters
+--               are incremented before first sample comes to the output).
+--               Harmonic generators with different delays (bh_win_3term, TAYLOR,
+--               PHI_WIDTH-LUT_SIZE = 3) use counter values of different clocks.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef VHD_MODEL_H
+#define VHD_MODEL_H
+
+#include "win_model.h"
+
+/* ---- SIN_TYPE and XSERIES generics --- */
+#define VHD_CORDIC    0
+#define VHD_TAYLOR    1
+
+#define VHD_7SERIES   0
+#define VHD_ULTRA     1
+
+/* ---- Phase of the first output sample --- */
+#define VHD_PHASE0    1
+
+/* ---- Model version: change it when results of the model change --- */
+#define VHD_VERSION   2
+
+/* ---- Generics of win_selector --- */
+typedef struct {
+	int phi_width; // PHI_WIDTH: window length = 2^phi_width
+	int dat_width; // DAT_WIDTH: output and coefficients width
+	int win_type;  // WIN_HAMMING, WIN_BH3, WIN_BH4, WIN_BH5, WIN_BH7
+	int sin_type;  // VHD_CORDIC / VHD_TAYLOR (hamming_win and bh_win_3term)
+	int lut_size;  // LUT_SIZE of taylor_sincos
+	int xseries;   // VHD_7SERIES / VHD_ULTRA
+} vhd_cfg_t;
+
+/* ---- WIN_TYPE / SIN_TYPE / XSERIES strings of VHDL generics --- */
+const char *vhd_win_name (
+	int win_type
+);
+
+int vhd_win_select (
+	const char *name
+);
+
+const char *vhd_sin_name (
+	int sin_type
+);
+
+const char *vhd_xseries_name (
+	int xseries
+);
+
+/* ---- Check generics: 0 - supported by RTL, 1 - not --- */
+int vhd_check (
+	const vhd_cfg_t *cfg
+);
+
+/* ---- Clear generics which do not change output data --- */
+void vhd_normalize (
+	vhd_cfg_t *cfg
+);
+
+/* ---- Constants AA0..AA6 as in tb_windows.vhd, returns number of terms --- */
+int vhd_coeffs (
+	const vhd_cfg_t *cfg,
+	long long *aa
+);
+
+/* ---- cordic_dds (PRECISION = 1): DT_COS and DT_SIN of PH_IN --- */
+void vhd_cordic (
+	int phase_width,
+	int data_width,
+	long long phase,
+	long long *out_cos,
+	long long *out_sin
+);
+
+/* ---- taylor_sincos: OUT_COS and OUT_SIN for counter value --- */
+void vhd_taylor (
+	int phase_width,
+	int data_width,
+	int lut_size,
+	long long phase,
+	long long *out_cos,
+	long long *out_sin
+);
+
+/* ---- Clocks from phase counter to cosine of harmonic m (1..6) --- */
+int vhd_sine_delay (
+	const vhd_cfg_t *cfg,
+	int m
+);
+
+/* ---- DT_WIN for counter values of each harmonic generator: phase[m], m = 1..6 --- */
+long long vhd_window_at (
+	const vhd_cfg_t *cfg,
+	const long long *aa,
+	const long long *phase
+);
+
+/* ---- DT_WIN for phase of the first harmonic (ENABLE is always '1') --- */
+long long vhd_window (
+	const vhd_cfg_t *cfg,
+	const long long *aa,
+	long long phase
+);
+
+/* ---- DT_WIN samples start, start+1, ... start+count-1 after reset --- */
+void vhd_window_block (
+	const vhd_cfg_t *cfg,
+	const long long *aa,
+	long long start,
+	long long count,
+	long long *out
+);
+
+#endif
@@ -0,0 +1,227 @@
+/*******************************************************************************
+--
+-- Title       : vhd_pipe.cpp
+-- Design      : Cycle model of VHDL window cores
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Clock-by-clock model of win_selector. Delays of pipeline stages are taken
+--               from RTL (cordic_dds, taylor_sincos, int_multNxN_dsp48, rounding and adder
+--               registers of each core), DSP48 slices are counted as synthesis infers them:
+--               signed NxN multiplier is split into 25x18 (7SERIES) or 27x18 (ULTRA) parts.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include "vhd_pipe.h"
+
+/* ---- Parts of signed operand for multiplier port of 'port' bits --- */
+static int mult_parts (
+		int width,
+		int port
+	)
+{
+	if (width <= port) {
+		return 1;
+	}
+	// Lower parts are unsigned: port-1 bits each //
+	return 1 + (width - port + port - 2) / (port - 1);
+}
+
+int vhd_mult_dsp48 (
+		int width,
+		int xseries
+	)
+{
+	const int port_a = (xseries == VHD_ULTRA) ? 27 : 25;
+	return mult_parts(width, port_a) * mult_parts(width, 18);
+}
+
+static int win_nterm (
+		int win_type
+	)
+{
+	return (win_type == WIN_HAMMING) ? 2 : win_type;
+}
+
+void vhd_stages (
+		const vhd_cfg_t *cfg,
+		vhd_stages_t *st
+	)
+{
+	st->sine = vhd_sine_delay(cfg, 1);
+	st->mult = 3;
+	st->round = 2;
+	st->output = 1;
+
+	switch (cfg->win_type) {
+		case WIN_BH4:
+		case WIN_BH5: st->adder = 2; break;
+		case WIN_BH7: st->adder = 3; break;
+		default:      st->adder = 1; break;
+	}
+	st->latency = st->sine + st->mult + st->round + st->adder + st->output;
+}
+
+/* ---- DSP48 of tay1_order: DSP48 with C port or two 35-bit multipliers and adders --- */
+static int taylor_dsp48 (
+		int pw,
+		int dw,
+		int lut
+	)
+{
+	if (pw - lut <= 2) {
+		return 0;
+	}
+	return (dw < 19) ? 2 : 2 * 2 + 2;
+}
+
+void vhd_usage (
+		const vhd_cfg_t *cfg,
+		vhd_usage_t *use
+	)
+{
+	const int nterm = win_nterm(cfg->win_type);
+
+	memset(use, 0, sizeof(vhd_usage_t));
+	use->sincos = nterm - 1;
+	use->dsp_mult = (nterm - 1) * vhd_mult_dsp48(cfg->dat_width, cfg->xseries);
+
+	// dsp_pp, dsp_p1..p3, dsp_q1..q2 (dsp_pz of bh_win_7term is a register) //
+	switch (cfg->win_type) {
+		case WIN_BH4:
+		case WIN_BH5: use->dsp_add = 3; break;
+		case WIN_BH7: use->dsp_add = 6; break;
+		default:      use->dsp_add = 1; break;
+	}
+
+	if ((cfg->sin_type == VHD_TAYLOR) && ((cfg->win_type == WIN_HAMMING) || (cfg->win_type == WIN_BH3))) {
+		int m;
+		for (m = 1; m < nterm; m++) {
+			int pw = cfg->phi_width - (m - 1);
+			use->dsp_sine += taylor_dsp48(pw, cfg->dat_width, cfg->lut_size);
+			use->rom_bits += (1LL << cfg->lut_size) * 2 * cfg->dat_width;
+		}
+		use->rom_block = (cfg->lut_size < 10) ? 0 : 1;
+	}
+	use->dsp_total = use->dsp_mult + use->dsp_add + use->dsp_sine;
+}
+
+int vhd_pipe_init (
+		vhd_pipe_t *pipe,
+		const vhd_cfg_t *cfg,
+		const long long *aa
+	)
+{
+	vhd_stages_t st;
+	vhd_stages(cfg, &st);
+
+	memset(pipe, 0, sizeof(vhd_pipe_t));
+	pipe->cfg = *cfg;
+	memcpy(pipe->aa, aa, sizeof(pipe->aa));
+	pipe->mask = (1LL << cfg->phi_width) - 1;
+	pipe->latency = st.latency;
+
+	// History of counter: the slowest harmonic generator looks back furthest //
+	int depth = st.latency;
+	int m;
+	for (m = 1; m < win_nterm(cfg->win_type); m++) {
+		int delay = st.latency - st.sine + vhd_sine_delay(cfg, m);
+		if (delay > depth) {
+			depth = delay;
+		}
+	}
+	pipe->depth = depth + 1;
+	pipe->line_phi = (long long *)calloc(pipe->depth, sizeof(long long));
+	pipe->line_ena = (char *)calloc(pipe->depth, sizeof(char));
+	pipe->last_vld = 0;
+
+	return (pipe->line_phi && pipe->line_ena) ? 0 : 1;
+}
+
+void vhd_pipe_free (
+		vhd_pipe_t *pipe
+	)
+{
+	free(pipe->line_phi);
+	free(pipe->line_ena);
+	pipe->line_phi = NULL;
+	pipe->line_ena = NULL;
+}
+
+void vhd_pipe_clock (
+		vhd_pipe_t *pipe,
+		int enable,
+		long long *dt_win,
+		int *dt_vld
+	)
+{
+	const long long t = pipe->clock;
+	const int depth = pipe->depth;
+	const int nterm = win_nterm(pipe->cfg.win_type);
+
+	// Rising edge: phase counters and ENABLE shift register //
+	if (enable) {
+		pipe->cnt = (pipe->cnt + 1) & pipe->mask;
+	}
+	pipe->line_phi[t % depth] = pipe->cnt;
+	pipe->line_ena[t % depth] = enable ? 1 : 0;
+	pipe->clock++;
+
+	// Registers are not filled after reset //
+	if (t < pipe->latency) {
+		*dt_win = 0;
+		*dt_vld = 0;
+		return;
+	}
+	*dt_vld = pipe->line_ena[(t - pipe->latency) % depth];
+
+	// DT_WIN follows counter with ENABLE = '0' too: data pipeline has no clock enable //
+	const int rest = pipe->latency - vhd_sine_delay(&pipe->cfg, 1);
+	long long phase[WIN_MAXTERM] = {0};
+	int same = pipe->last_vld;
+	int m;
+	for (m = 1; m < nterm; m++) {
+		long long back = rest + vhd_sine_delay(&pipe->cfg, m);
+		phase[m] = (t >= back) ? pipe->line_phi[(t - back) % depth] : 0;
+		same &= (phase[m] == pipe->last_phase[m]) ? 1 : 0;
+	}
+	if (!same) {
+		pipe->last_win = vhd_window_at(&pipe->cfg, pipe->aa, phase);
+		memcpy(pipe->last_phase, phase, sizeof(phase));
+		pipe->last_vld = 1;
+	}
+	*dt_win = pipe->last_win;
+}
@@ -0,0 +1,125 @@
+/*******************************************************************************
+--
+-- Title       : vhd_pipe.h
+-- Design      : Cycle model of VHDL window cores
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Clock-by-clock model of win_selector: ENABLE -> DT_VLD delay line
+--               (ena_zz of each core), phase counter and bit-exact DT_WIN (cpp/vhd_model).
+--               Pipeline stages of sine generator, multipliers, rounding and adders and
+--               number of DSP48 slices are given per configuration of generics.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef VHD_PIPE_H
+#define VHD_PIPE_H
+
+#include "vhd_model.h"
+
+/* ---- Pipeline stages of win_selector (clocks) --- */
+typedef struct {
+	int sine;      // counter -> DT_COS of cordic_dds / OUT_COS of taylor_sincos
+	int mult;      // mult_b, int_multNxN_dsp48 (input and output registers)
+	int round;     // dsp_r, dsp_b
+	int adder;     // adder tree: dsp_p*, dsp_q*, dsp_pp
+	int output;    // DT_WIN register
+	int latency;   // ENABLE -> DT_VLD (ena_zz + DT_VLD register)
+} vhd_stages_t;
+
+/* ---- Resources of win_selector --- */
+typedef struct {
+	int dsp_mult;  // DSP48 of int_multNxN_dsp48 (inferred multiplier)
+	int dsp_add;   // DSP48 of adders with USE_DSP attribute
+	int dsp_sine;  // DSP48 of taylor_sincos (tay1_order)
+	int dsp_total;
+	int sincos;    // number of cordic_dds or taylor_sincos
+	long long rom_bits; // ROM of taylor_sincos
+	int rom_block; // 1 - block RAM (LUT_SIZE >= 10), 0 - distributed
+} vhd_usage_t;
+
+/* ---- State of cycle model --- */
+typedef struct {
+	vhd_cfg_t cfg;
+	long long aa[WIN_MAXTERM];
+	long long mask;
+	int latency;
+	int depth;            // length of delay lines
+	long long cnt;        // phase counter of window core
+	long long *line_phi;  // counter value after each rising edge
+	char *line_ena;       // ENABLE on each rising edge
+	long long clock;
+	long long last_phase[WIN_MAXTERM]; // DT_WIN of the last counter values
+	long long last_win;
+	int last_vld;
+} vhd_pipe_t;
+
+/* ---- DSP48 slices of signed NxN multiplier inferred by synthesis --- */
+int vhd_mult_dsp48 (
+	int width,
+	int xseries
+);
+
+/* ---- Pipeline stages and ENABLE -> DT_VLD latency --- */
+void vhd_stages (
+	const vhd_cfg_t *cfg,
+	vhd_stages_t *st
+);
+
+/* ---- DSP48 and ROM of configuration --- */
+void vhd_usage (
+	const vhd_cfg_t *cfg,
+	vhd_usage_t *use
+);
+
+/* ---- Cycle model: state after RESET --- */
+int vhd_pipe_init (
+	vhd_pipe_t *pipe,
+	const vhd_cfg_t *cfg,
+	const long long *aa
+);
+
+void vhd_pipe_free (
+	vhd_pipe_t *pipe
+);
+
+/* ---- One rising edge of CLK: ENABLE in, DT_WIN and DT_VLD out --- */
+void vhd_pipe_clock (
+	vhd_pipe_t *pipe,
+	int enable,
+	long long *dt_win,
+	int *dt_vld
+);
+
+#endif
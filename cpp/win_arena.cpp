@@ -0,0 +1,277 @@
+/*******************************************************************************
+--
+-- Title       : win_arena.cpp
+-- Design      : Huge-page arena for window tables and DDS buffers
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Mapping order: 1G pages (arena >= 1G), 2M pages (arena >= 2M), normal
+--               pages aligned to 2M with MADV_HUGEPAGE. Failed hugetlbfs mapping (empty
+--               pool, no kernel support) falls back to next page size silently. NUMA
+--               binding by mbind() syscall (MPOL_PREFERRED, no libnuma dependency).
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "win_arena.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+/* ---- NUMA policy for mbind() --- */
+#define ARENA_MPOL_PREFERRED 1
+#define ARENA_MAX_NODE       64
+
+static size_t arena_round (
+		size_t size,
+		size_t page
+	)
+{
+	return (size + page - 1) / page * page;
+}
+
+#if defined(__linux__)
+static char *arena_hugetlb (
+		size_t size,
+		int shift
+	)
+{
+	void *ptr = mmap(NULL, size, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (shift << MAP_HUGE_SHIFT), -1, 0);
+	return (ptr == MAP_FAILED) ? NULL : (char *)ptr;
+}
+
+/* ---- Normal pages: base aligned to 2M for THP --- */
+static char *arena_pages (
+		size_t size
+	)
+{
+	size_t over = size + ARENA_PAGE_2M;
+	void *ptr = mmap(NULL, over, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (ptr == MAP_FAILED) {
+		return NULL;
+	}
+	char *raw = (char *)ptr;
+	char *base = (char *)arena_round((size_t)raw, ARENA_PAGE_2M);
+	if (base > raw) {
+		munmap(raw, base - raw);
+	}
+	if (raw + over > base + size) {
+		munmap(base + size, raw + over - (base + size));
+	}
+	return base;
+}
+#endif
+
+int win_arena_init (
+		win_arena_t *arena,
+		size_t size,
+		int policy
+	)
+{
+	memset(arena, 0, sizeof(win_arena_t));
+	arena->node = -1;
+	if (size == 0) {
+		size = ARENA_ALIGN;
+	}
+
+#if defined(__linux__)
+	unsigned cpu = 0, node = 0;
+	if (syscall(SYS_getcpu, &cpu, &node, NULL) == 0) {
+		arena->node = (int)node;
+	}
+
+	if (policy == ARENA_HUGE) {
+		if (size >= ARENA_PAGE_1G) {
+			arena->size = arena_round(size, ARENA_PAGE_1G);
+			arena->base = arena_hugetlb(arena->size, 30);
+			arena->page = ARENA_PAGE_1G;
+		}
+		if (!arena->base && (size >= ARENA_PAGE_2M)) {
+			arena->size = arena_round(size, ARENA_PAGE_2M);
+			arena->base = arena_hugetlb(arena->size, 21);
+			arena->page = ARENA_PAGE_2M;
+		}
+	}
+	if (!arena->base) {
+		arena->size = arena_round(size, (policy == ARENA_HUGE) ? ARENA_PAGE_2M : ARENA_PAGE_4K);
+		arena->base = arena_pages(arena->size);
+		arena->page = ARENA_PAGE_4K;
+		if (arena->base && (policy == ARENA_HUGE)) {
+			arena->thp = (madvise(arena->base, arena->size, MADV_HUGEPAGE) == 0);
+		} else if (arena->base) {
+			madvise(arena->base, arena->size, MADV_NOHUGEPAGE);
+		}
+	}
+	if (!arena->base) {
+		return 1;
+	}
+
+	// Local node: preferred policy, then first touch by this thread //
+	if ((arena->node >= 0) && (arena->node < ARENA_MAX_NODE)) {
+		unsigned long mask = 1UL << arena->node;
+		arena->bound = (syscall(SYS_mbind, arena->base, arena->size, ARENA_MPOL_PREFERRED, &mask, ARENA_MAX_NODE + 1, 0) == 0);
+	}
+	size_t pos;
+	for (pos = 0; pos < arena->size; pos += ARENA_PAGE_4K) {
+		arena->base[pos] = 0;
+	}
+#else
+	(void)policy;
+	arena->size = arena_round(size, ARENA_PAGE_4K);
+	arena->base = (char *)aligned_alloc(ARENA_PAGE_4K, arena->size);
+	arena->page = ARENA_PAGE_4K;
+	if (!arena->base) {
+		return 1;
+	}
+#endif
+	return 0;
+}
+
+void win_arena_free (
+		win_arena_t *arena
+	)
+{
+	if (arena->base) {
+#if defined(__linux__)
+		munmap(arena->base, arena->size);
+#else
+		free(arena->base);
+#endif
+	}
+	arena->base = NULL;
+	arena->size = 0;
+	arena->used = 0;
+}
+
+void *win_arena_alloc (
+		win_arena_t *arena,
+		size_t bytes
+	)
+{
+	size_t len = arena_round(bytes ? bytes : 1, ARENA_ALIGN);
+	if (!arena->base || (len > arena->size - arena->used)) {
+		arena->nfails++;
+		return NULL;
+	}
+
+	void *ptr = arena->base + arena->used;
+	arena->used += len;
+	arena->requested += bytes;
+	arena->nallocs++;
+	if (arena->used > arena->peak) {
+		arena->peak = arena->used;
+	}
+	return ptr;
+}
+
+void win_arena_reset (
+		win_arena_t *arena
+	)
+{
+	arena->used = 0;
+}
+
+/* ---- AnonHugePages of mapping from /proc/self/smaps --- */
+static size_t arena_thp_bytes (
+		const win_arena_t *arena
+	)
+{
+	size_t total = 0;
+#if defined(__linux__)
+	if (!arena->thp) {
+		return 0;
+	}
+	FILE *fp = fopen("/proc/self/smaps", "r");
+	if (!fp) {
+		return 0;
+	}
+	const unsigned long lo = (unsigned long)arena->base;
+	const unsigned long hi = lo + arena->size;
+	int inside = 0;
+	char line[256];
+	while (fgets(line, sizeof(line), fp)) {
+		unsigned long beg, end;
+		unsigned long kb;
+		if (sscanf(line, "%lx-%lx ", &beg, &end) == 2) {
+			inside = (beg < hi) && (end > lo);
+		} else if (inside && (sscanf(line, "AnonHugePages: %lu kB", &kb) == 1)) {
+			total += kb * 1024;
+		}
+	}
+	fclose(fp);
+#else
+	(void)arena;
+#endif
+	return total;
+}
+
+void win_arena_stats (
+		const win_arena_t *arena,
+		arena_stats_t *stats
+	)
+{
+	stats->size = arena->size;
+	stats->used = arena->used;
+	stats->peak = arena->peak;
+	stats->requested = arena->requested;
+	stats->page = arena->page;
+	stats->thp_bytes = arena_thp_bytes(arena);
+	stats->node = arena->node;
+	stats->bound = arena->bound;
+	stats->nallocs = arena->nallocs;
+	stats->nfails = arena->nfails;
+}
+
+const char *win_arena_page (
+		size_t page
+	)
+{
+	if (page >= ARENA_PAGE_1G) {
+		return "1G";
+	} else if (page >= ARENA_PAGE_2M) {
+		return "2M";
+	}
+	return "4K";
+}
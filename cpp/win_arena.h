@@ -0,0 +1,127 @@
+/*******************************************************************************
+--
+-- Title       : win_arena.h
+-- Design      : Huge-page arena for window tables and DDS buffers
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Bump allocator over one mapping for large window tables, harmonic bases
+--               and DDS buffers. Mapping uses 1G or 2M huge pages (hugetlbfs) when pool
+--               has them, else normal pages with transparent huge pages (THP) advice.
+--               Pages are bound to NUMA node of thread which calls win_arena_init() and
+--               touched by this thread: one arena per generating thread. All blocks are
+--               aligned to ARENA_ALIGN bytes for SIMD kernels.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef WIN_ARENA_H
+#define WIN_ARENA_H
+
+#include <stddef.h>
+
+/* ---- Alignment of every block (cache line, AVX-512 vector) --- */
+#ifndef ARENA_ALIGN
+#define ARENA_ALIGN  64
+#endif
+
+/* ---- Page sizes --- */
+#define ARENA_PAGE_4K  (1ULL << 12)
+#define ARENA_PAGE_2M  (1ULL << 21)
+#define ARENA_PAGE_1G  (1ULL << 30)
+
+/* ---- Page policy: huge pages if possible or normal pages only --- */
+#define ARENA_HUGE     0
+#define ARENA_NOHUGE   1
+
+typedef struct {
+	char *base;
+	size_t size;        // mapped bytes
+	size_t used;        // bytes of allocated blocks with alignment
+	size_t peak;        // maximum of used
+	size_t requested;   // sum of requested bytes
+	size_t page;        // page size of mapping (ARENA_PAGE_*)
+	int thp;            // normal pages with THP advice
+	int node;           // NUMA node of init thread, -1 - unknown
+	int bound;          // pages are bound to node
+	long long nallocs;  // allocated blocks
+	long long nfails;   // requests over arena size
+} win_arena_t;
+
+/* ---- Statistics of arena --- */
+typedef struct {
+	size_t size;
+	size_t used;
+	size_t peak;
+	size_t requested;
+	size_t page;
+	size_t thp_bytes;   // bytes mapped by transparent huge pages
+	int node;
+	int bound;
+	long long nallocs;
+	long long nfails;
+} arena_stats_t;
+
+/* ---- Arena of at least size bytes: 0 - ok, 1 - error --- */
+int win_arena_init (
+	win_arena_t *arena,
+	size_t size,
+	int policy
+);
+
+void win_arena_free (
+	win_arena_t *arena
+);
+
+/* ---- Block of bytes aligned to ARENA_ALIGN or NULL if arena is full --- */
+void *win_arena_alloc (
+	win_arena_t *arena,
+	size_t bytes
+);
+
+/* ---- Free all blocks (pages stay mapped) --- */
+void win_arena_reset (
+	win_arena_t *arena
+);
+
+void win_arena_stats (
+	const win_arena_t *arena,
+	arena_stats_t *stats
+);
+
+/* ---- Page size name: "1G", "2M" or "4K" --- */
+const char *win_arena_page (
+	size_t page
+);
+
+#endif
@@ -0,0 +1,378 @@
+/*******************************************************************************
+--
+-- Title       : win_bench.cpp
+-- Design      : Window functions: benchmark
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Performance of host model kernels: CORDIC (full and hybrid), every
+--               window function, whole-window generation from 2^10 to 2^26 points and
+--               CORDIC DDS loop. Each test has warm-up run and repetitions, result is
+--               ns/sample, samples/sec and cycles/sample (x86 TSC) in JSON.
+--               
+--               Usage: win_bench [-w window] [-W NWIDTH] [-r repeats] [-n max log2 N] [-o bench.json]
+--               Example: win_bench -w Blackman-Harris-4 -W 24 -r 5 -n 26 -o bench.json
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_TSC 1
+#else
+#define BENCH_TSC 0
+#endif
+
+#include "win_model.h"
+#include "dsp48_model.h"
+
+/* ---- Samples per kernel test and block for whole-window generation --- */
+#define BENCH_PHASE 16
+#define BENCH_BLOCK 65536
+
+/* ---- Maximum number of repetitions --- */
+#define BENCH_RMAX 64
+
+typedef struct {
+	const win_cfg_t *cfg;
+	int win_type;
+	long long nsamples;
+	long long *buf;
+	void *aux;
+} bench_arg_t;
+
+typedef long long (*bench_fn)(const bench_arg_t *arg);
+
+/* ---- Results are summed to keep compiler from removing the loops --- */
+static volatile long long bench_sink;
+
+static long long run_cordic (
+		const bench_arg_t *arg
+	)
+{
+	long long sum = 0;
+	long long i, c, s;
+	for (i = 0; i < arg->nsamples; i++) {
+		win_cordic(arg->cfg, i, &c, &s);
+		sum += c ^ s;
+	}
+	return sum;
+}
+
+static long long run_window (
+		const bench_arg_t *arg
+	)
+{
+	long long sum = 0;
+	long long start;
+	for (start = 0; start < arg->nsamples; start += BENCH_BLOCK) {
+		long long count = (start + BENCH_BLOCK > arg->nsamples) ? arg->nsamples - start : BENCH_BLOCK;
+		win_model_block(arg->cfg, arg->win_type, start, count, arg->buf);
+		sum += arg->buf[count - 1];
+	}
+	return sum;
+}
+
+/* ---- Typed output: conversion in kernel --- */
+template <typename T>
+static long long run_typed (
+		const bench_arg_t *arg
+	)
+{
+	T *out = (T *)arg->aux;
+	long long sum = 0;
+	long long start;
+	for (start = 0; start < arg->nsamples; start += BENCH_BLOCK) {
+		long long count = (start + BENCH_BLOCK > arg->nsamples) ? arg->nsamples - start : BENCH_BLOCK;
+		win_model_block_as<T>(arg->cfg, arg->win_type, start, count, out);
+		sum += (long long)out[count - 1];
+	}
+	return sum;
+}
+
+/* ---- Float output by second pass over integer window --- */
+static long long run_float_pass (
+		const bench_arg_t *arg
+	)
+{
+	double coe[WIN_MAXTERM];
+	int shift;
+	win_coeffs(arg->win_type, coe, &shift);
+	const float inv = (float)(1.0 / (pow(2.0, arg->cfg->nwidth - shift) - 1.0));
+
+	float *out = (float *)arg->aux;
+	long long sum = 0;
+	long long start, n;
+	for (start = 0; start < arg->nsamples; start += BENCH_BLOCK) {
+		long long count = (start + BENCH_BLOCK > arg->nsamples) ? arg->nsamples - start : BENCH_BLOCK;
+		win_model_block(arg->cfg, arg->win_type, start, count, arg->buf);
+		for (n = 0; n < count; n++) {
+			out[n] = (float)arg->buf[n] * inv;
+		}
+		sum += (long long)out[count - 1];
+	}
+	return sum;
+}
+
+/* ---- DDS: phase accumulator with increment as in cordic_dds.vhd --- */
+static long long run_dds (
+		const bench_arg_t *arg
+	)
+{
+	const long long step = 0x12345 & ((1LL << arg->cfg->nphase) - 1);
+	const long long mask = (1LL << arg->cfg->nphase) - 1;
+
+	long long sum = 0;
+	long long phase = 0;
+	long long i, c, s;
+	for (i = 0; i < arg->nsamples; i++) {
+		win_cordic(arg->cfg, phase, &c, &s);
+		sum += c ^ s;
+		phase = (phase + step) & mask;
+	}
+	return sum;
+}
+
+/* ---- DSP48 models: CORDIC DDS48 and 35x25 multiplier by blocks --- */
+#define BENCH_DSP 1024
+
+static long long run_dds48 (
+		const bench_arg_t *arg
+	)
+{
+	long long ph[BENCH_DSP], s[BENCH_DSP], c[BENCH_DSP];
+
+	long long sum = 0;
+	long long start;
+	int j;
+	for (start = 0; start < arg->nsamples; start += BENCH_DSP) {
+		for (j = 0; j < BENCH_DSP; j++) {
+			ph[j] = start + j;
+		}
+		dds48_block(arg->cfg->nphase, arg->cfg->nwidth, ph, BENCH_DSP, s, c);
+		sum += s[BENCH_DSP - 1] ^ c[BENCH_DSP - 1];
+	}
+	return sum;
+}
+
+static long long run_mlt35 (
+		const bench_arg_t *arg
+	)
+{
+	long long a[BENCH_DSP], b[BENCH_DSP], p[BENCH_DSP];
+
+	long long sum = 0;
+	long long start;
+	int j;
+	for (start = 0; start < arg->nsamples; start += BENCH_DSP) {
+		for (j = 0; j < BENCH_DSP; j++) {
+			a[j] = (start + j) * 0x2F0F1;
+			b[j] = (start - j) * 0x1B3;
+		}
+		mlt35x25_block(a, b, BENCH_DSP, p);
+		sum += p[BENCH_DSP - 1];
+	}
+	return sum;
+}
+
+static int cmp_double (
+		const void *a,
+		const void *b
+	)
+{
+	double da = *(const double *)a;
+	double db = *(const double *)b;
+	return (da < db) ? -1 : (da > db) ? 1 : 0;
+}
+
+static void bench (
+		FILE *fout,
+		int *first,
+		const char *name,
+		bench_fn fn,
+		const bench_arg_t *arg,
+		int repeats
+	)
+{
+	double ns[BENCH_RMAX];
+	double cyc[BENCH_RMAX];
+
+	// Warm-up //
+	bench_sink = fn(arg);
+
+	int r;
+	for (r = 0; r < repeats; r++) {
+#if BENCH_TSC
+		unsigned long long t0 = __rdtsc();
+#endif
+		auto start = std::chrono::steady_clock::now();
+		bench_sink = fn(arg);
+		auto stop = std::chrono::steady_clock::now();
+#if BENCH_TSC
+		cyc[r] = (double)(__rdtsc() - t0) / arg->nsamples;
+#else
+		cyc[r] = -1.0;
+#endif
+		ns[r] = std::chrono::duration<double, std::nano>(stop - start).count() / arg->nsamples;
+	}
+	qsort(ns, repeats, sizeof(double), cmp_double);
+	qsort(cyc, repeats, sizeof(double), cmp_double);
+
+	// Text to stderr if JSON goes to stdout //
+	double med = ns[repeats / 2];
+	fprintf((fout == stdout) ? stderr : stdout, "%-32s %10lld samples: %10.2f ns/sample (min %.2f), %12.0f samples/sec, %8.1f cycles/sample\n",
+		name, arg->nsamples, med, ns[0], 1e9 / med, cyc[repeats / 2]);
+
+	fprintf(fout, "%s    {\"name\": \"%s\", \"samples\": %lld, \"repeats\": %d, \"ns_per_sample\": %.4f, \"ns_min\": %.4f, \"samples_per_sec\": %.1f, ",
+		*first ? "" : ",\n", name, arg->nsamples, repeats, med, ns[0], 1e9 / med);
+	if (BENCH_TSC) {
+		fprintf(fout, "\"cycles_per_sample\": %.2f}", cyc[repeats / 2]);
+	} else {
+		fprintf(fout, "\"cycles_per_sample\": null}");
+	}
+	*first = 0;
+}
+
+int main (int argc, char **argv) {
+
+	int win_type = WIN_BH4;
+	int nwidth = 24;
+	int repeats = 5;
+	int nmax = 26;
+	const char *fname = NULL;
+
+	int i;
+	for (i = 1; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-w") == 0) {
+			win_type = win_select(argv[i+1]);
+		} else if (strcmp(argv[i], "-W") == 0) {
+			nwidth = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-r") == 0) {
+			repeats = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-n") == 0) {
+			nmax = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-o") == 0) {
+			fname = argv[i+1];
+		}
+	}
+	if ((win_type == WIN_EMPTY) || (nwidth < 8) || (nwidth > 40) || (nmax < 10) || (nmax > 30)) {
+		printf("FAIL: wrong window, NWIDTH or max length\n");
+		return 1;
+	}
+	if (repeats < 1) {
+		repeats = 1;
+	} else if (repeats > BENCH_RMAX) {
+		repeats = BENCH_RMAX;
+	}
+
+	FILE *fout = fname ? fopen(fname, "w") : stdout;
+	if (!fout) {
+		printf("FAIL: cannot open %s\n", fname);
+		return 1;
+	}
+
+	long long *buf = (long long *)malloc(BENCH_BLOCK * sizeof(long long));
+	double *aux = (double *)malloc(BENCH_BLOCK * sizeof(double));
+
+	win_cfg_t cfg_full = { BENCH_PHASE, nwidth, 0, nwidth };
+	win_cfg_t cfg_hybr = { BENCH_PHASE, nwidth, 0, nwidth / 2 + 2 };
+
+	bench_arg_t arg = { &cfg_full, win_type, 1LL << BENCH_PHASE, buf, aux };
+	int first = 1;
+	char name[64];
+
+	fprintf(fout, "{\n  \"nwidth\": %d,\n  \"window\": \"%s\",\n  \"results\": [\n", nwidth, win_name(win_type));
+
+	// CORDIC kernels //
+	bench(fout, &first, "cordic", run_cordic, &arg, repeats);
+	arg.cfg = &cfg_hybr;
+	bench(fout, &first, "cordic_hybrid", run_cordic, &arg, repeats);
+	arg.cfg = &cfg_full;
+
+	// Every window function //
+	static const int types[] = { WIN_HAMMING, WIN_HANN, WIN_BH3, WIN_BH4, WIN_BH5, WIN_BH7 };
+	for (i = 0; i < (int)(sizeof(types) / sizeof(types[0])); i++) {
+		arg.win_type = types[i];
+		snprintf(name, sizeof(name), "win/%s", win_name(types[i]));
+		bench(fout, &first, name, run_window, &arg, repeats);
+	}
+	arg.win_type = win_type;
+
+	// Output types //
+	bench(fout, &first, "win_as/float32", run_typed<float>, &arg, repeats);
+	bench(fout, &first, "win_as/float64", run_typed<double>, &arg, repeats);
+	bench(fout, &first, "win_as/int16", run_typed<int16_t>, &arg, repeats);
+	bench(fout, &first, "win_as/int32", run_typed<int32_t>, &arg, repeats);
+	bench(fout, &first, "win_pass/float32", run_float_pass, &arg, repeats);
+
+	// Whole window: 2^10, 2^14 ... and 2^nmax //
+	int n;
+	for (n = 10; ; n = (n + 4 < nmax) ? n + 4 : nmax) {
+		win_cfg_t cfg = { n, nwidth, 0, nwidth };
+		arg.cfg = &cfg;
+		arg.nsamples = 1LL << n;
+		snprintf(name, sizeof(name), "window/2^%d", n);
+		bench(fout, &first, name, run_window, &arg, (n > 20) ? 1 : repeats);
+		if (n == nmax) {
+			break;
+		}
+	}
+
+	// DDS loop //
+	win_cfg_t cfg_dds = { 20, nwidth, 0, nwidth };
+	arg.cfg = &cfg_dds;
+	arg.nsamples = 1LL << BENCH_PHASE;
+	bench(fout, &first, "dds", run_dds, &arg, repeats);
+
+	// DSP48 models //
+	arg.cfg = &cfg_full;
+	bench(fout, &first, "dds48", run_dds48, &arg, repeats);
+	bench(fout, &first, "mlt35x25", run_mlt35, &arg, repeats);
+
+	fprintf(fout, "\n  ]\n}\n");
+	if (fname) {
+		fclose(fout);
+		printf("Results are written to %s\n", fname);
+	}
+
+	free(buf);
+	free(aux);
+	return 0;
+}
@@ -0,0 +1,264 @@
+/*******************************************************************************
+--
+-- Title       : win_check.cpp
+-- Design      : Window functions: chunked verification
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Compare bit-exact model of HLS win_function with double precision
+--               golden window up to 2^26 points and more. Window is streamed in blocks
+--               of fixed size on all cores, memory does not depend on window length.
+--               Threads merge error statistics: RMS, bias, max abs error and histogram.
+--               
+--               Usage: win_check <window> <NPHASE> <NWIDTH> [-p NPREC] [-i NITER]
+--                                [-t threads] [-b block] [-e max error] [-H 0|1]
+--               Example: win_check Blackman-Harris-4 26 24
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <atomic>
+#include <thread>
+
+#include "win_model.h"
+#include "win_arena.h"
+
+/* ---- Default block size (samples) and error limit (LSB) --- */
+#define CHECK_BLOCK 65536
+#define CHECK_ERROR 16
+
+/* ---- Error histogram: -HIST_MAX..HIST_MAX LSB, outer bins collect the rest --- */
+#define HIST_MAX 8
+
+typedef struct {
+	long long count;
+	double sum_err;
+	double sum_err2;
+	long long max_err;
+	long long max_idx;
+	long long hist[2*HIST_MAX+1];
+} check_t;
+
+static void check_merge (
+		check_t *dst,
+		const check_t *src
+	)
+{
+	dst->count += src->count;
+	dst->sum_err += src->sum_err;
+	dst->sum_err2 += src->sum_err2;
+	if ((src->max_err > dst->max_err) || ((src->max_err == dst->max_err) && (src->max_idx < dst->max_idx))) {
+		dst->max_err = src->max_err;
+		dst->max_idx = src->max_idx;
+	}
+	int k;
+	for (k = 0; k < 2*HIST_MAX+1; k++) {
+		dst->hist[k] += src->hist[k];
+	}
+}
+
+static void check_block (
+		const win_cfg_t *cfg,
+		int win_type,
+		long long start,
+		long long count,
+		long long *dat_hls,
+		double *dat_dbl,
+		check_t *res
+	)
+{
+	double coe[WIN_MAXTERM];
+	int shift;
+	win_coeffs(win_type, coe, &shift);
+	const double scale = pow(2.0, cfg->nwidth-shift) - 1.0;
+
+	win_model_block(cfg, win_type, start, count, dat_hls);
+	win_golden_block(win_type, start, count, 1LL << cfg->nphase, dat_dbl);
+
+	long long n;
+	for (n = 0; n < count; n++) {
+		long long err = dat_hls[n] - (long long)round(scale * dat_dbl[n]);
+		long long abs_err = (err < 0) ? -err : err;
+
+		res->count++;
+		res->sum_err += (double)err;
+		res->sum_err2 += (double)err * (double)err;
+		if (abs_err > res->max_err) {
+			res->max_err = abs_err;
+			res->max_idx = start + n;
+		}
+		if (err < -HIST_MAX) {
+			err = -HIST_MAX;
+		} else if (err > HIST_MAX) {
+			err = HIST_MAX;
+		}
+		res->hist[err + HIST_MAX]++;
+	}
+}
+
+int main (int argc, char **argv) {
+
+	if (argc < 4) {
+		printf("Usage: %s <window> <NPHASE> <NWIDTH> [-p NPREC] [-i NITER] [-t threads] [-b block] [-e max error] [-H 0|1]\n", argv[0]);
+		return 1;
+	}
+
+	win_cfg_t cfg;
+	int win_type = win_select(argv[1]);
+	cfg.nphase = atoi(argv[2]);
+	cfg.nwidth = atoi(argv[3]);
+	cfg.nprec = 0;
+	cfg.niter = cfg.nwidth;
+
+	int nthreads = std::thread::hardware_concurrency();
+	long long block = CHECK_BLOCK;
+	int policy = ARENA_HUGE;
+	long long max_err = CHECK_ERROR;
+
+	int i;
+	for (i = 4; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-p") == 0) {
+			cfg.nprec = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-i") == 0) {
+			cfg.niter = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-t") == 0) {
+			nthreads = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-b") == 0) {
+			block = atoll(argv[i+1]);
+		} else if (strcmp(argv[i], "-e") == 0) {
+			max_err = atoll(argv[i+1]);
+		} else if (strcmp(argv[i], "-H") == 0) {
+			policy = atoi(argv[i+1]) ? ARENA_HUGE : ARENA_NOHUGE;
+		}
+	}
+	if (nthreads < 1) {
+		nthreads = 1;
+	}
+	if (block < 1) {
+		block = CHECK_BLOCK;
+	}
+
+	if ((win_type == WIN_EMPTY) || (cfg.nphase < 4) || (cfg.nphase > 40) || (cfg.nwidth < 4) || (cfg.nwidth > 40)) {
+		printf("FAIL: unknown window %s or wrong widths\n", argv[1]);
+		return 1;
+	}
+
+	const long long nsamples = 1LL << cfg.nphase;
+	const long long nblocks = (nsamples + block - 1) / block;
+
+	printf("Window %s: NPHASE = %d, NWIDTH = %d, NPREC = %d, NITER = %d\n",
+		win_name(win_type), cfg.nphase, cfg.nwidth, cfg.nprec, cfg.niter);
+	printf("Samples = %lld, blocks = %lld x %lld, threads = %d\n", nsamples, nblocks, block, nthreads);
+
+	// Each thread takes next block and keeps own statistics //
+	std::atomic<long long> next(0);
+	check_t *part = (check_t *)calloc(nthreads, sizeof(check_t));
+	arena_stats_t *mem = (arena_stats_t *)calloc(nthreads, sizeof(arena_stats_t));
+	std::thread *pool = new std::thread[nthreads];
+
+	for (i = 0; i < nthreads; i++) {
+		check_t *res = &part[i];
+		arena_stats_t *st = &mem[i];
+		pool[i] = std::thread([&, res, st]() {
+			// Block buffers on local node, huge pages if possible //
+			win_arena_t arena;
+			if (win_arena_init(&arena, block * (sizeof(long long) + sizeof(double)) + 2 * ARENA_ALIGN, policy)) {
+				st->nfails = 1;
+				return;
+			}
+			long long *dat_hls = (long long *)win_arena_alloc(&arena, block * sizeof(long long));
+			double *dat_dbl = (double *)win_arena_alloc(&arena, block * sizeof(double));
+			for (;;) {
+				long long idx = next++;
+				if (idx >= nblocks) {
+					break;
+				}
+				long long start = idx * block;
+				long long count = (start + block > nsamples) ? nsamples - start : block;
+				check_block(&cfg, win_type, start, count, dat_hls, dat_dbl, res);
+			}
+			win_arena_stats(&arena, st);
+			win_arena_free(&arena);
+		});
+	}
+
+	check_t total;
+	memset(&total, 0, sizeof(total));
+	for (i = 0; i < nthreads; i++) {
+		pool[i].join();
+		check_merge(&total, &part[i]);
+	}
+	delete[] pool;
+	free(part);
+
+	size_t mem_thp = 0;
+	long long mem_fails = 0;
+	for (i = 0; i < nthreads; i++) {
+		mem_thp += mem[i].thp_bytes;
+		mem_fails += mem[i].nfails;
+	}
+	printf("Arena: %d x %.1f MB, pages %s, THP %.1f MB, node %d%s\n", nthreads, mem[0].size / 1048576.0,
+		win_arena_page(mem[0].page), mem_thp / 1048576.0, mem[0].node, mem[0].bound ? " (bound)" : "");
+	free(mem);
+	if (mem_fails) {
+		printf("FAIL: cannot allocate block buffers\n");
+		return 1;
+	}
+
+	double rms = sqrt(total.sum_err2 / total.count);
+	double bias = total.sum_err / total.count;
+
+	printf("\nError (LSB): RMS = %.4f, bias = %.4f, max = %lld at sample %lld\n", rms, bias, total.max_err, total.max_idx);
+	printf("Histogram:\n");
+	int k;
+	for (k = 0; k < 2*HIST_MAX+1; k++) {
+		if (total.hist[k] == 0) {
+			continue;
+		}
+		const char *edge = (k == 0) ? "<=" : (k == 2*HIST_MAX) ? ">=" : "  ";
+		printf("  %s%3d : %lld\n", edge, k - HIST_MAX, total.hist[k]);
+	}
+
+	if (total.max_err <= max_err) {
+		printf ("PASS: Data matches the golden output!\n");
+		return 0;
+	} else {
+		printf ("FAIL: Data DOES NOT match the golden output\n");
+		return 1;
+	}
+}
@@ -0,0 +1,866 @@
+/*******************************************************************************
+--
+-- Title       : win_daemon.cpp
+-- Design      : Local window daemon with shared-memory handoff
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Serves window tables to processes on one host over Unix domain socket
+--               (cpp/win_serve). Each table is built once into sealed memfd segment, reply
+--               passes its descriptor (SCM_RIGHTS), clients map it read-only (zero copy).
+--               Concurrent requests of the same table wait for one build (deduplication),
+--               LRU cache of DAEMON_TABLES tables and DAEMON_BYTES bytes. Samples are int32
+--               for NWIDTH <= 32 and int64 above. Socket is in $XDG_RUNTIME_DIR, created
+--               with mode 0600, both sides check peer uid (SO_PEERCRED). Custom coefficients
+--               must be finite and fit in NWIDTH bits. Metrics: requests, cache hits, shared
+--               builds, misses, latency of request and table build.
+--               
+--               Usage: win_daemon serve [-s socket] [-t threads] [-m MiB]
+--                      win_daemon get <window|custom> <N> <NWIDTH> [-c a0,a1,...] [-h shift]
+--                      win_daemon bench <window> <N> <NWIDTH> [-t clients] [-r requests]
+--                      win_daemon stats
+--               Example: win_daemon serve & win_daemon bench Blackman-Harris-4 65536 24
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "win_serve.h"
+#include "win_master.h"
+
+/* ---- Cache size (tables and bytes) and maximum window length --- */
+#ifndef DAEMON_TABLES
+#define DAEMON_TABLES 64
+#endif
+#ifndef DAEMON_BYTES
+#define DAEMON_BYTES  (1LL << 30)
+#endif
+#define DAEMON_MAXLEN (1LL << 28)
+
+/* ---- Samples per block of parallel table build --- */
+#define DAEMON_BLOCK  65536
+
+/* ---- Cache entry state --- */
+#define ENTRY_EMPTY   0
+#define ENTRY_BUILD   1
+#define ENTRY_READY   2
+
+typedef struct {
+	serve_req_t key;  // normalized request
+	int state;
+	int fd;           // sealed memfd
+	long long bytes;  // segment size (reserved while table is built)
+	long long stamp;  // last use (LRU)
+} entry_t;
+
+static struct {
+	std::mutex lock;
+	std::condition_variable done;
+	entry_t tab[DAEMON_TABLES];
+	long long clock;
+	long long budget; // bytes of all tables
+	serve_stats_t st;
+	double lat_sum;
+	double build_sum;
+
+	std::mutex mst_lock;
+	win_master_t mst[WIN_MAXTERM + 1];
+	int nthreads;
+} srv;
+
+static char sock_name[sizeof(((struct sockaddr_un *)0)->sun_path)];
+static const char *sock_path = sock_name;
+
+static double time_ns (
+		std::chrono::steady_clock::time_point start
+	)
+{
+	auto stop = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+/* ---------------- Table build ---------------- */
+
+/* ---- Bytes per sample: int32 up to 32 bits --- */
+static int table_elem (
+		int nwidth
+	)
+{
+	return (nwidth <= 32) ? 4 : 8;
+}
+
+/* ---- Request to cache key: 0 - ok, 1 - wrong request --- */
+static int req_normalize (
+		const serve_req_t *req,
+		serve_req_t *key
+	)
+{
+	memset(key, 0, sizeof(serve_req_t));
+	if ((req->magic != SERVE_MAGIC) || (req->op != SERVE_GET)) {
+		return 1;
+	}
+	if ((req->nsamples < 4) || (req->nsamples > DAEMON_MAXLEN) || (req->nwidth < 4) || (req->nwidth > 40)) {
+		return 1;
+	}
+	// Master table is Q1.30: N != 2^k of standard window up to 32 bits //
+	if ((req->win_type != WIN_EMPTY) && (req->nsamples & (req->nsamples - 1)) && (req->nwidth > 32)) {
+		return 1;
+	}
+	key->win_type = req->win_type;
+	key->nwidth = req->nwidth;
+	key->nsamples = req->nsamples;
+
+	if (req->win_type != WIN_EMPTY) {
+		double coe[WIN_MAXTERM];
+		int shift;
+		return (win_coeffs(req->win_type, coe, &shift) > 0) ? 0 : 1;
+	}
+
+	// Custom coefficients //
+	if ((req->nterm < 1) || (req->nterm > WIN_MAXTERM) || (req->shift < 0) || (req->shift > 3)) {
+		return 1;
+	}
+	key->nterm = req->nterm;
+	key->shift = req->shift;
+
+	// Finite coefficients, |w| <= sum |coe| * scale fits in NWIDTH bits //
+	const double scale = pow(2.0, req->nwidth - req->shift) - 1.0;
+	double sum = 0.0;
+	int k;
+	for (k = 0; k < req->nterm; k++) {
+		if (!isfinite(req->coe[k])) {
+			return 1;
+		}
+		key->coe[k] = req->coe[k];
+		sum += fabs(req->coe[k]);
+	}
+	if (sum * scale > pow(2.0, req->nwidth - 1) - 1.0) {
+		return 1;
+	}
+	return 0;
+}
+
+/* ---- Custom window: exact cosines, rounded to scale 2^(NWIDTH-shift) - 1 --- */
+static void build_custom (
+		const serve_req_t *key,
+		long long start,
+		long long count,
+		long long *out
+	)
+{
+	const double scale = pow(2.0, key->nwidth - key->shift) - 1.0;
+	long long n;
+	int k;
+	for (n = 0; n < count; n++) {
+		double c1 = cos(2.0 * M_PI * (start + n) / key->nsamples);
+		double ck = c1;
+		double ck1 = 1.0;
+		double sum = key->coe[0];
+		for (k = 1; k < key->nterm; k++) {
+			sum += (k & 1) ? -key->coe[k] * ck : key->coe[k] * ck;
+			double cn = 2.0 * c1 * ck - ck1;
+			ck1 = ck;
+			ck = cn;
+		}
+		out[n] = (long long)round(sum * scale);
+	}
+}
+
+/* ---- Master table of window type for N != 2^k, built once --- */
+static const win_master_t *build_master (
+		int win_type
+	)
+{
+	std::lock_guard<std::mutex> guard(srv.mst_lock);
+	win_master_t *mst = &srv.mst[win_type];
+	if (!mst->tab && win_master_init(mst, win_type, MASTER_BITS)) {
+		return NULL;
+	}
+	return mst;
+}
+
+static void build_block (
+		const serve_req_t *key,
+		const win_master_t *mst,
+		long long start,
+		long long count,
+		long long *out
+	)
+{
+	if (key->win_type == WIN_EMPTY) {
+		build_custom(key, start, count, out);
+	} else if (mst) {
+		win_master_block(mst, key->nsamples, key->nwidth, start, count, out);
+	} else {
+		win_cfg_t cfg;
+		cfg.nphase = 0;
+		while ((1LL << cfg.nphase) < key->nsamples) {
+			cfg.nphase++;
+		}
+		cfg.nwidth = key->nwidth;
+		cfg.nprec = 0;
+		cfg.niter = key->nwidth;
+		win_model_block(&cfg, key->win_type, start, count, out);
+	}
+}
+
+/* ---- Sealed segment with table: fd or -1 --- */
+static int build_table (
+		const serve_req_t *key,
+		long long *bytes
+	)
+{
+	const long long nsamples = key->nsamples;
+	const int elem = table_elem(key->nwidth);
+	*bytes = nsamples * elem;
+
+	const win_master_t *mst = NULL;
+	if ((key->win_type != WIN_EMPTY) && (nsamples & (nsamples - 1))) {
+		mst = build_master(key->win_type);
+		if (!mst) {
+			return -1;
+		}
+	}
+
+	int fd = memfd_create("win_table", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+	if (fd < 0) {
+		return -1;
+	}
+	if (ftruncate(fd, *bytes) < 0) {
+		close(fd);
+		return -1;
+	}
+	void *ptr = mmap(NULL, *bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (ptr == MAP_FAILED) {
+		close(fd);
+		return -1;
+	}
+	long long *out64 = (long long *)ptr;
+	int32_t *out32 = (int32_t *)ptr;
+
+	// Blocks on all threads, int32 table through block buffer of each thread //
+	const long long nblocks = (nsamples + DAEMON_BLOCK - 1) / DAEMON_BLOCK;
+	const int nthreads = (nblocks < srv.nthreads) ? (int)nblocks : srv.nthreads;
+	std::atomic<long long> next(0);
+	std::thread *pool = new std::thread[nthreads];
+	int i;
+	for (i = 0; i < nthreads; i++) {
+		pool[i] = std::thread([&]() {
+			long long *buf = (elem == 4) ? (long long *)malloc(DAEMON_BLOCK * sizeof(long long)) : NULL;
+			for (;;) {
+				long long idx = next++;
+				if (idx >= nblocks) {
+					break;
+				}
+				long long start = idx * DAEMON_BLOCK;
+				long long count = (start + DAEMON_BLOCK > nsamples) ? nsamples - start : DAEMON_BLOCK;
+				if (elem == 8) {
+					build_block(key, mst, start, count, out64 + start);
+					continue;
+				}
+				build_block(key, mst, start, count, buf);
+				long long n;
+				for (n = 0; n < count; n++) {
+					out32[start + n] = (int32_t)buf[n];
+				}
+			}
+			free(buf);
+		});
+	}
+	for (i = 0; i < nthreads; i++) {
+		pool[i].join();
+	}
+	delete[] pool;
+
+	// Read-only for clients: no writable mapping may exist before sealing //
+	munmap(ptr, *bytes);
+	if (fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) < 0) {
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+/* ---------------- Cache ---------------- */
+
+/* ---- Free entry for table of need bytes: least recently used tables are
+	evicted until the table fits in byte budget, NULL if only tables being
+	built are left --- */
+static entry_t *cache_reserve (
+		long long need
+	)
+{
+	for (;;) {
+		entry_t *ent = NULL;
+		entry_t *lru = NULL;
+		int i;
+		for (i = 0; i < DAEMON_TABLES; i++) {
+			entry_t *cur = &srv.tab[i];
+			if ((cur->state == ENTRY_EMPTY) && !ent) {
+				ent = cur;
+			}
+			if ((cur->state == ENTRY_READY) && (!lru || (cur->stamp < lru->stamp))) {
+				lru = cur;
+			}
+		}
+		if (ent && (srv.st.bytes + need <= srv.budget)) {
+			return ent;
+		}
+		if (!lru) {
+			return NULL;
+		}
+		close(lru->fd);
+		lru->state = ENTRY_EMPTY;
+		srv.st.evicted++;
+		srv.st.tables--;
+		srv.st.bytes -= lru->bytes;
+	}
+}
+
+/* ---- Descriptor of table (dup, caller closes) or -1, *hit: table was cached --- */
+static int cache_get (
+		const serve_req_t *key,
+		long long *bytes,
+		int *hit
+	)
+{
+	const long long need = key->nsamples * table_elem(key->nwidth);
+	if (need > srv.budget) {
+		return -1;
+	}
+
+	std::unique_lock<std::mutex> lk(srv.lock);
+
+	entry_t *ent = NULL;
+	int i;
+	for (;;) {
+		ent = NULL;
+		for (i = 0; i < DAEMON_TABLES; i++) {
+			if ((srv.tab[i].state != ENTRY_EMPTY) && (memcmp(&srv.tab[i].key, key, sizeof(serve_req_t)) == 0)) {
+				ent = &srv.tab[i];
+				break;
+			}
+		}
+		if (ent && (ent->state == ENTRY_READY)) {
+			if (!*hit) {
+				srv.st.hits++;
+			}
+			*hit = 1;
+			ent->stamp = ++srv.clock;
+			*bytes = ent->bytes;
+			return dup(ent->fd);
+		}
+		if (ent) {
+			// Same table is being built: wait for it //
+			if (!*hit) {
+				srv.st.shared++;
+			}
+			*hit = 1;
+			srv.done.wait(lk);
+			continue;
+		}
+
+		// Miss: free entry or the least recently used tables //
+		ent = cache_reserve(need);
+		if (ent) {
+			break;
+		}
+		// Cache is full of tables being built: wait for one of them //
+		int building = 0;
+		for (i = 0; i < DAEMON_TABLES; i++) {
+			building |= (srv.tab[i].state == ENTRY_BUILD);
+		}
+		if (!building) {
+			return -1;
+		}
+		srv.done.wait(lk);
+	}
+
+	ent->key = *key;
+	ent->state = ENTRY_BUILD;
+	ent->fd = -1;
+	ent->bytes = need;
+	srv.st.bytes += need;
+	srv.st.misses++;
+	*hit = 0;
+	lk.unlock();
+
+	auto start = std::chrono::steady_clock::now();
+	int fd = build_table(key, bytes);
+	double build_ns = time_ns(start);
+
+	lk.lock();
+	srv.build_sum += build_ns;
+	if (fd < 0) {
+		ent->state = ENTRY_EMPTY;
+		srv.st.bytes -= need;
+		srv.done.notify_all();
+		return -1;
+	}
+	ent->fd = fd;
+	ent->state = ENTRY_READY;
+	ent->stamp = ++srv.clock;
+	srv.st.tables++;
+	srv.done.notify_all();
+	return dup(fd);
+}
+
+/* ---------------- Server ---------------- */
+
+static int send_reply (
+		int sock,
+		const void *buf,
+		size_t len,
+		int fd
+	)
+{
+	union {
+		char buf[CMSG_SPACE(sizeof(int))];
+		struct cmsghdr align;
+	} ctl;
+	struct iovec iov = { (void *)buf, len };
+	struct msghdr msg;
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+
+	if (fd >= 0) {
+		memset(&ctl, 0, sizeof(ctl));
+		msg.msg_control = ctl.buf;
+		msg.msg_controllen = sizeof(ctl.buf);
+		struct cmsghdr *cm = CMSG_FIRSTHDR(&msg);
+		cm->cmsg_level = SOL_SOCKET;
+		cm->cmsg_type = SCM_RIGHTS;
+		cm->cmsg_len = CMSG_LEN(sizeof(int));
+		memcpy(CMSG_DATA(cm), &fd, sizeof(int));
+	}
+	return (sendmsg(sock, &msg, MSG_NOSIGNAL) == (ssize_t)len) ? 0 : 1;
+}
+
+static void serve_client (
+		int sock
+	)
+{
+	serve_req_t req;
+	for (;;) {
+		ssize_t ret = recv(sock, &req, sizeof(req), 0);
+		if (ret != (ssize_t)sizeof(req)) {
+			break;
+		}
+		auto start = std::chrono::steady_clock::now();
+
+		serve_rep_t rep;
+		memset(&rep, 0, sizeof(rep));
+		rep.magic = SERVE_MAGIC;
+
+		if ((req.magic == SERVE_MAGIC) && (req.op == SERVE_STATS)) {
+			char buf[sizeof(serve_rep_t) + sizeof(serve_stats_t)];
+			serve_stats_t st;
+			{
+				std::lock_guard<std::mutex> guard(srv.lock);
+				st = srv.st;
+				st.lat_avg_ns = st.requests ? srv.lat_sum / st.requests : 0.0;
+				st.build_avg_ns = st.misses ? srv.build_sum / st.misses : 0.0;
+			}
+			memcpy(buf, &rep, sizeof(rep));
+			memcpy(buf + sizeof(rep), &st, sizeof(st));
+			if (send_reply(sock, buf, sizeof(buf), -1)) {
+				break;
+			}
+			continue;
+		}
+
+		serve_req_t key;
+		int fd = -1;
+		if (req_normalize(&req, &key)) {
+			rep.status = SERVE_EINVAL;
+		} else {
+			fd = cache_get(&key, &rep.bytes, &rep.hit);
+			rep.status = (fd < 0) ? SERVE_ENOMEM : SERVE_OK;
+			rep.nwidth = key.nwidth;
+			rep.elem = table_elem(key.nwidth);
+			rep.nsamples = key.nsamples;
+		}
+		rep.latency_ns = (long long)time_ns(start);
+
+		{
+			std::lock_guard<std::mutex> guard(srv.lock);
+			srv.st.requests++;
+			srv.st.errors += (rep.status != SERVE_OK);
+			srv.lat_sum += rep.latency_ns;
+			if (rep.latency_ns > srv.st.lat_max_ns) {
+				srv.st.lat_max_ns = rep.latency_ns;
+			}
+		}
+
+		ret = send_reply(sock, &rep, sizeof(rep), fd);
+		if (fd >= 0) {
+			close(fd);
+		}
+		if (ret) {
+			break;
+		}
+	}
+	close(sock);
+}
+
+static void on_signal (
+		int sig
+	)
+{
+	(void)sig;
+	unlink(sock_path);
+	_exit(0);
+}
+
+static int run_server (
+		int nthreads,
+		long long budget
+	)
+{
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (strlen(sock_path) >= sizeof(addr.sun_path)) {
+		printf("FAIL: socket path is too long\n");
+		return 1;
+	}
+	strcpy(addr.sun_path, sock_path);
+
+	// Tables are for processes of the same user only: socket is created with mode 0600 //
+	int lsock = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+	unlink(sock_path);
+	mode_t mask = umask(077);
+	int ret = (lsock < 0) || bind(lsock, (struct sockaddr *)&addr, sizeof(addr));
+	umask(mask);
+	if (ret || listen(lsock, 64)) {
+		printf("FAIL: cannot listen on %s\n", sock_path);
+		return 1;
+	}
+	if (chmod(sock_path, 0600)) {
+		printf("FAIL: cannot set mode of %s\n", sock_path);
+		unlink(sock_path);
+		return 1;
+	}
+	signal(SIGINT, on_signal);
+	signal(SIGTERM, on_signal);
+
+	srv.nthreads = (nthreads > 0) ? nthreads : (int)std::thread::hardware_concurrency();
+	if (srv.nthreads < 1) {
+		srv.nthreads = 1;
+	}
+	srv.budget = budget;
+	printf("Listening on %s, %d build threads, %d tables, %lld MiB\n", sock_path, srv.nthreads, DAEMON_TABLES, budget >> 20);
+	fflush(stdout);
+
+	for (;;) {
+		int sock = accept4(lsock, NULL, NULL, SOCK_CLOEXEC);
+		if (sock < 0) {
+			continue;
+		}
+		struct ucred cred;
+		socklen_t len = sizeof(cred);
+		if (getsockopt(sock, SOL_SOCKET, SO_PEERCRED, &cred, &len) || (cred.uid != getuid())) {
+			close(sock);
+			continue;
+		}
+		std::thread(serve_client, sock).detach();
+	}
+	return 0;
+}
+
+/* ---------------- Clients ---------------- */
+
+/* ---- Compare table with local generation (standard or custom window) --- */
+static long long check_table (
+		const serve_req_t *req,
+		const serve_rep_t *rep,
+		const void *table
+	)
+{
+	serve_req_t key;
+	if (req_normalize(req, &key)) {
+		return -1;
+	}
+
+	win_master_t mst;
+	memset(&mst, 0, sizeof(mst));
+	if ((key.win_type != WIN_EMPTY) && (key.nsamples & (key.nsamples - 1)) && win_master_init(&mst, key.win_type, MASTER_BITS)) {
+		return -1;
+	}
+	long long *ref = (long long *)malloc(DAEMON_BLOCK * sizeof(long long));
+	long long diff = 0;
+	long long start, n;
+	for (start = 0; start < key.nsamples; start += DAEMON_BLOCK) {
+		long long count = (start + DAEMON_BLOCK > key.nsamples) ? key.nsamples - start : DAEMON_BLOCK;
+		build_block(&key, mst.tab ? &mst : NULL, start, count, ref);
+		for (n = 0; n < count; n++) {
+			diff += (ref[n] != win_serve_sample(rep, table, start + n));
+		}
+	}
+	free(ref);
+	win_master_free(&mst);
+	return diff;
+}
+
+static int parse_req (
+		serve_req_t *req,
+		int argc,
+		char **argv
+	)
+{
+	int custom = (strcmp(argv[2], "custom") == 0);
+	win_serve_req(req, custom ? WIN_EMPTY : win_select(argv[2]), atoll(argv[3]), atoi(argv[4]));
+	req->shift = 1;
+
+	int i;
+	for (i = 5; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-c") == 0) {
+			const char *ptr = argv[i+1];
+			req->nterm = 0;
+			while (ptr && *ptr && (req->nterm < WIN_MAXTERM)) {
+				req->coe[req->nterm++] = atof(ptr);
+				ptr = strchr(ptr, ',');
+				if (ptr) {
+					ptr++;
+				}
+			}
+		} else if (strcmp(argv[i], "-h") == 0) {
+			req->shift = atoi(argv[i+1]);
+		}
+	}
+	return (!custom && (req->win_type == WIN_EMPTY)) ? 1 : 0;
+}
+
+static int run_get (
+		int argc,
+		char **argv
+	)
+{
+	serve_req_t req;
+	if (parse_req(&req, argc, argv)) {
+		printf("FAIL: unknown window %s\n", argv[2]);
+		return 1;
+	}
+	int sock = win_serve_connect(sock_path);
+	if (sock < 0) {
+		printf("FAIL: no daemon on %s\n", sock_path);
+		return 1;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	serve_rep_t rep;
+	const void *table;
+	int ret = win_serve_get(sock, &req, &rep, &table);
+	double rtt_ns = time_ns(start);
+	close(sock);
+	if (ret) {
+		printf("FAIL: request error %d\n", rep.status);
+		return 1;
+	}
+
+	long long diff = check_table(&req, &rep, table);
+	printf("{\"n\": %lld, \"nwidth\": %d, \"elem\": %d, \"bytes\": %lld, \"hit\": %d, \"latency_us\": %.1f, \"rtt_us\": %.1f, \"mismatch\": %lld, \"center\": %lld}\n",
+		rep.nsamples, rep.nwidth, rep.elem, rep.bytes, rep.hit, rep.latency_ns * 1e-3, rtt_ns * 1e-3, diff, win_serve_sample(&rep, table, rep.nsamples / 2));
+	win_serve_unmap(table, rep.bytes);
+
+	if (diff) {
+		printf("FAIL: table differs from local model\n");
+		return 1;
+	}
+	printf("PASS: table is mapped\n");
+	return 0;
+}
+
+static int cmp_double (
+		const void *a,
+		const void *b
+	)
+{
+	double da = *(const double *)a;
+	double db = *(const double *)b;
+	return (da < db) ? -1 : (da > db) ? 1 : 0;
+}
+
+/* ---- Concurrent clients request the same table --- */
+static int run_bench (
+		int argc,
+		char **argv
+	)
+{
+	serve_req_t req;
+	if (parse_req(&req, argc, argv)) {
+		printf("FAIL: unknown window %s\n", argv[2]);
+		return 1;
+	}
+	int nclients = 8;
+	int nreq = 16;
+	int i;
+	for (i = 5; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-t") == 0) {
+			nclients = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-r") == 0) {
+			nreq = atoi(argv[i+1]);
+		}
+	}
+	if ((nclients < 1) || (nreq < 1)) {
+		printf("FAIL: wrong number of clients or requests\n");
+		return 1;
+	}
+
+	double *rtt = (double *)malloc((size_t)nclients * nreq * sizeof(double));
+	std::atomic<long long> fails(0);
+	std::atomic<long long> hits(0);
+	std::thread *pool = new std::thread[nclients];
+	for (i = 0; i < nclients; i++) {
+		pool[i] = std::thread([&, i]() {
+			int sock = win_serve_connect(sock_path);
+			int r;
+			for (r = 0; r < nreq; r++) {
+				auto start = std::chrono::steady_clock::now();
+				serve_rep_t rep;
+				const void *table;
+				if ((sock < 0) || win_serve_get(sock, &req, &rep, &table)) {
+					fails++;
+					rtt[i * nreq + r] = 0.0;
+					continue;
+				}
+				rtt[i * nreq + r] = time_ns(start);
+				hits += rep.hit;
+				win_serve_unmap(table, rep.bytes);
+			}
+			if (sock >= 0) {
+				close(sock);
+			}
+		});
+	}
+	for (i = 0; i < nclients; i++) {
+		pool[i].join();
+	}
+	delete[] pool;
+
+	const int total = nclients * nreq;
+	qsort(rtt, total, sizeof(double), cmp_double);
+	printf("{\"clients\": %d, \"requests\": %d, \"hits\": %lld, \"fails\": %lld, \"rtt_p50_us\": %.1f, \"rtt_p99_us\": %.1f, \"rtt_max_us\": %.1f}\n",
+		nclients, total, hits.load(), fails.load(), rtt[total / 2] * 1e-3, rtt[(total * 99) / 100] * 1e-3, rtt[total - 1] * 1e-3);
+	free(rtt);
+
+	if (fails) {
+		printf("FAIL: %lld requests failed\n", fails.load());
+		return 1;
+	}
+	printf("PASS: %d requests\n", total);
+	return 0;
+}
+
+static int run_stats (void) {
+	int sock = win_serve_connect(sock_path);
+	serve_stats_t st;
+	if ((sock < 0) || win_serve_stats(sock, &st)) {
+		printf("FAIL: no daemon on %s\n", sock_path);
+		return 1;
+	}
+	close(sock);
+
+	const long long served = st.requests - st.errors;
+	printf("{\"requests\": %lld, \"hits\": %lld, \"shared\": %lld, \"misses\": %lld, \"errors\": %lld, \"hit_rate\": %.4f,\n",
+		st.requests, st.hits, st.shared, st.misses, st.errors, served ? (double)(st.hits + st.shared) / served : 0.0);
+	printf(" \"tables\": %lld, \"bytes\": %lld, \"evicted\": %lld, \"latency_avg_us\": %.1f, \"latency_max_us\": %.1f, \"build_avg_ms\": %.3f}\n",
+		st.tables, st.bytes, st.evicted, st.lat_avg_ns * 1e-3, st.lat_max_ns * 1e-3, st.build_avg_ns * 1e-6);
+	return 0;
+}
+
+int main (int argc, char **argv) {
+
+	if (argc < 2) {
+		printf("Usage: %s serve [-s socket] [-t threads] [-m MiB]\n", argv[0]);
+		printf("       %s get <window|custom> <N> <NWIDTH> [-c a0,a1,...] [-h shift] [-s socket]\n", argv[0]);
+		printf("       %s bench <window> <N> <NWIDTH> [-t clients] [-r requests] [-s socket]\n", argv[0]);
+		printf("       %s stats [-s socket]\n", argv[0]);
+		return 1;
+	}
+
+	if (win_serve_path(sock_name, sizeof(sock_name))) {
+		printf("FAIL: socket path is too long\n");
+		return 1;
+	}
+
+	int nthreads = 0;
+	long long budget = DAEMON_BYTES;
+	int i;
+	for (i = 2; i + 1 < argc; i++) {
+		if (strcmp(argv[i], "-s") == 0) {
+			sock_path = argv[i+1];
+		} else if ((strcmp(argv[i], "-t") == 0) && (strcmp(argv[1], "serve") == 0)) {
+			nthreads = atoi(argv[i+1]);
+		} else if ((strcmp(argv[i], "-m") == 0) && (strcmp(argv[1], "serve") == 0)) {
+			budget = atoll(argv[i+1]) << 20;
+		}
+	}
+
+	if (strcmp(argv[1], "serve") == 0) {
+		if (budget <= 0) {
+			printf("FAIL: wrong cache size\n");
+			return 1;
+		}
+		return run_server(nthreads, budget);
+	} else if (strcmp(argv[1], "stats") == 0) {
+		return run_stats();
+	} else if (argc < 5) {
+		printf("FAIL: window, N and NWIDTH are required\n");
+		return 1;
+	} else if (strcmp(argv[1], "get") == 0) {
+		return run_get(argc, argv);
+	} else if (strcmp(argv[1], "bench") == 0) {
+		return run_bench(argc, argv);
+	}
+	printf("FAIL: unknown command %s\n", argv[1]);
+	return 1;
+}
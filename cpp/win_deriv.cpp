@@ -0,0 +1,189 @@
+/*******************************************************************************
+--
+-- Title       : win_deriv.cpp
+-- Design      : Window, derivative and time-ramped window for reassigned spectrogram
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Window w, derivative N/(2*pi)*dw/di and time-ramped window (i-N/2)*w
+--               from one pass of the model (cpp/win_model, win_model_deriv): derivative
+--               is a weighted sum of sines of the same CORDIC calls. Checks window with
+--               win_model_block, derivative with exact derivative and with numerical
+--               differencing of the integer window, time of one pass and window only.
+--               
+--               Usage: win_deriv <window> <NPHASE> <NWIDTH> [-e max error] [-o out.csv]
+--               Example: win_deriv Blackman-Harris-4 16 24
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <chrono>
+
+#include "win_model.h"
+
+/* ---- Default error limit of derivative (LSB of NWIDTH) --- */
+#define DERIV_ERROR 32
+
+static double time_ns (
+		std::chrono::steady_clock::time_point start
+	)
+{
+	auto stop = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+/* ---- Exact derivative: N/(2*pi) * dw/di in LSB of NWIDTH --- */
+static double deriv_golden (
+		const double *coe,
+		int nterm,
+		double scale,
+		long long i,
+		long long nsamples
+	)
+{
+	double sum = 0.0;
+	int k;
+	for (k = 1; k < nterm; k++) {
+		double val = k * coe[k] * sin(2.0 * M_PI * ((k * i) % nsamples) / nsamples);
+		sum += (k & 1) ? val : -val;
+	}
+	return sum * scale;
+}
+
+int main (int argc, char **argv) {
+
+	if (argc < 4) {
+		printf("Usage: %s <window> <NPHASE> <NWIDTH> [-e max error] [-o out.csv]\n", argv[0]);
+		return 1;
+	}
+
+	win_cfg_t cfg;
+	int win_type = win_select(argv[1]);
+	cfg.nphase = atoi(argv[2]);
+	cfg.nwidth = atoi(argv[3]);
+	cfg.nprec = 0;
+	cfg.niter = cfg.nwidth;
+
+	double max_lim = DERIV_ERROR;
+	const char *fname = NULL;
+
+	int i;
+	for (i = 4; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-e") == 0) {
+			max_lim = atof(argv[i+1]);
+		} else if (strcmp(argv[i], "-o") == 0) {
+			fname = argv[i+1];
+		}
+	}
+	if ((win_type == WIN_EMPTY) || (cfg.nphase < 4) || (cfg.nphase > 26) || (cfg.nwidth < 8) || (cfg.nwidth > 32)) {
+		printf("FAIL: unknown window %s or wrong widths\n", argv[1]);
+		return 1;
+	}
+
+	const long long nsamples = 1LL << cfg.nphase;
+	long long *win = (long long *)malloc(nsamples * sizeof(long long));
+	long long *dwin = (long long *)malloc(nsamples * sizeof(long long));
+	long long *twin = (long long *)malloc(nsamples * sizeof(long long));
+	long long *ref = (long long *)malloc(nsamples * sizeof(long long));
+
+	auto start = std::chrono::steady_clock::now();
+	win_model_deriv(&cfg, win_type, 0, nsamples, win, dwin, twin);
+	double deriv_ns = time_ns(start);
+
+	start = std::chrono::steady_clock::now();
+	win_model_block(&cfg, win_type, 0, nsamples, ref);
+	double block_ns = time_ns(start);
+
+	double coe[WIN_MAXTERM];
+	int shift;
+	int nterm = win_coeffs(win_type, coe, &shift);
+	const double scale = pow(2.0, cfg.nwidth - shift) - 1.0;
+
+	long long win_diff = 0, twin_diff = 0;
+	double max_err = 0.0, max_num = 0.0;
+	long long n;
+	for (n = 0; n < nsamples; n++) {
+		win_diff += (win[n] != ref[n]);
+		twin_diff += (twin[n] != (n - nsamples / 2) * win[n]);
+
+		double gld = deriv_golden(coe, nterm, scale, n, nsamples);
+		double err = fabs((double)dwin[n] - gld);
+		if (err > max_err) {
+			max_err = err;
+		}
+
+		// Central difference of integer window (periodic) //
+		long long prv = win[(n - 1) & (nsamples - 1)];
+		long long nxt = win[(n + 1) & (nsamples - 1)];
+		double num = (double)(nxt - prv) / 2.0 * nsamples / (2.0 * M_PI);
+		err = fabs(num - gld);
+		if (err > max_num) {
+			max_num = err;
+		}
+	}
+
+	printf("{\n  \"window\": \"%s\", \"nphase\": %d, \"nwidth\": %d,\n", win_name(win_type), cfg.nphase, cfg.nwidth);
+	printf("  \"win_mismatch\": %lld, \"twin_mismatch\": %lld,\n", win_diff, twin_diff);
+	printf("  \"dwin_max_err\": %.4f, \"numeric_max_err\": %.4f,\n", max_err, max_num);
+	printf("  \"deriv_ns\": %.3f, \"window_ns\": %.3f\n}\n", deriv_ns / nsamples, block_ns / nsamples);
+
+	if (fname) {
+		FILE *fp = fopen(fname, "w");
+		if (!fp) {
+			printf("FAIL: cannot open %s\n", fname);
+			return 1;
+		}
+		fprintf(fp, "i,win,dwin,twin\n");
+		for (n = 0; n < nsamples; n++) {
+			fprintf(fp, "%lld,%lld,%lld,%lld\n", n, win[n], dwin[n], twin[n]);
+		}
+		fclose(fp);
+	}
+
+	free(win);
+	free(dwin);
+	free(twin);
+	free(ref);
+
+	if (win_diff || twin_diff || (max_err > max_lim)) {
+		printf("FAIL: window, derivative or time-ramped window is wrong\n");
+		return 1;
+	}
+	printf("PASS: w, dw/dt and t*w match\n");
+	return 0;
+}
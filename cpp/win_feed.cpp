@@ -0,0 +1,281 @@
+/*******************************************************************************
+--
+-- Title       : win_feed.cpp
+-- Design      : Real-time window / DDS stream through lock-free ring buffer
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Producer thread generates window (win_model_block) or CORDIC DDS
+--               (win_cordic) blocks ahead of demand, consumer threads read every block,
+--               check stream continuity and samples against the model. Consumers can be
+--               throttled (blocks per ms) to show backpressure; counters go to JSON.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "win_model.h"
+#include "win_ring.h"
+
+/* ---- Samples checked in each block: first, middle and last --- */
+#define FEED_CHECKS 3
+
+typedef struct {
+	win_cfg_t cfg;
+	int win_type;      // window engine, WIN_EMPTY - DDS
+	long long step;    // DDS phase increment
+} feed_src_t;
+
+/* ---- Sample of stream: window sample (periodic) or DDS cosine --- */
+static long long feed_sample (
+		const feed_src_t *src,
+		long long i
+	)
+{
+	const long long mask = (1LL << src->cfg.nphase) - 1;
+	if (src->win_type != WIN_EMPTY) {
+		return win_model(&src->cfg, src->win_type, i & mask);
+	}
+	long long c, s;
+	win_cordic(&src->cfg, (i * src->step) & mask, &c, &s);
+	return c;
+}
+
+static void feed_gen (
+		void *ctx,
+		long long start,
+		long long count,
+		long long *out
+	)
+{
+	const feed_src_t *src = (const feed_src_t *)ctx;
+	const long long n = 1LL << src->cfg.nphase;
+
+	if (src->win_type == WIN_EMPTY) {
+		long long i;
+		for (i = 0; i < count; i++) {
+			out[i] = feed_sample(src, start + i);
+		}
+		return;
+	}
+
+	// Window engine: blocks of window period //
+	while (count > 0) {
+		long long pos = start & (n - 1);
+		long long len = (n - pos < count) ? n - pos : count;
+		win_model_block(&src->cfg, src->win_type, pos, len, out);
+		start += len;
+		count -= len;
+		out += len;
+	}
+}
+
+typedef struct {
+	win_ring_t *ring;
+	const feed_src_t *src;
+	int cons;
+	int rate;          // blocks per ms, 0 - no limit
+	long long errors;  // wrong samples or broken stream
+} feed_arg_t;
+
+static void feed_consume (
+		feed_arg_t *arg,
+		std::chrono::steady_clock::time_point t_end
+	)
+{
+	win_ring_t *ring = arg->ring;
+	const long long block = ring->block;
+	long long next = 0;
+	long long taken = 0;
+	auto t_start = std::chrono::steady_clock::now();
+
+	for (;;) {
+		auto now = std::chrono::steady_clock::now();
+		if (now >= t_end) {
+			break;
+		}
+		if (arg->rate) {
+			long long us = std::chrono::duration_cast<std::chrono::microseconds>(now - t_start).count();
+			if (taken * 1000 >= us * arg->rate) {
+				std::this_thread::yield();
+				continue;
+			}
+		}
+
+		long long start;
+		const long long *blk = win_ring_acquire(ring, arg->cons, &start);
+		if (!blk) {
+			std::this_thread::yield();
+			continue;
+		}
+
+		if (start != next) {
+			arg->errors++;
+		}
+		static const int pos[FEED_CHECKS] = { 0, 1, 2 };
+		int k;
+		for (k = 0; k < FEED_CHECKS; k++) {
+			long long j = pos[k] * (block - 1) / 2;
+			if (blk[j] != feed_sample(arg->src, start + j)) {
+				arg->errors++;
+			}
+		}
+		win_ring_release(ring, arg->cons);
+		next = start + block;
+		taken++;
+	}
+}
+
+static void usage (void) {
+	printf("Usage: win_feed [-w window|dds] [-p NPHASE] [-W NWIDTH] [-s step]\n"
+		"                [-c consumers] [-n blocks] [-b block] [-r blocks/ms] [-t ms] [-o file]\n");
+}
+
+int main (int argc, char **argv) {
+
+	feed_src_t src;
+	src.cfg.nphase = 16;
+	src.cfg.nwidth = 24;
+	src.cfg.nprec = 0;
+	src.cfg.niter = 24;
+	src.win_type = WIN_BH4;
+	src.step = 1;
+
+	int ncons = 2;
+	int nblocks = 64;
+	int block = 1024;
+	int rate = 0;
+	int ms = 500;
+	const char *fname = NULL;
+
+	int i;
+	for (i = 1; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-w") == 0) {
+			src.win_type = (strcmp(argv[i+1], "dds") == 0) ? WIN_EMPTY : win_select(argv[i+1]);
+			if ((src.win_type == WIN_EMPTY) && strcmp(argv[i+1], "dds")) {
+				usage();
+				return 1;
+			}
+		} else if (strcmp(argv[i], "-p") == 0) {
+			src.cfg.nphase = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-W") == 0) {
+			src.cfg.nwidth = src.cfg.niter = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-s") == 0) {
+			src.step = atoll(argv[i+1]);
+		} else if (strcmp(argv[i], "-c") == 0) {
+			ncons = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-n") == 0) {
+			nblocks = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-b") == 0) {
+			block = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-r") == 0) {
+			rate = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-t") == 0) {
+			ms = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-o") == 0) {
+			fname = argv[i+1];
+		}
+	}
+	if ((src.cfg.nphase < 4) || (src.cfg.nphase > 30) || (src.cfg.nwidth < 8) || (src.cfg.nwidth > 40) || (ms < 1) || (rate < 0)) {
+		printf("FAIL: wrong NPHASE, NWIDTH, rate or time\n");
+		return 1;
+	}
+
+	win_ring_t *ring = new win_ring_t;
+	if (win_ring_init(ring, nblocks, block, ncons, feed_gen, &src)) {
+		printf("FAIL: ring needs 2^k blocks, block > 0 and 1..%d consumers\n", RING_MAX_CONS);
+		delete ring;
+		return 1;
+	}
+
+	FILE *fout = fname ? fopen(fname, "w") : stdout;
+	if (!fout) {
+		printf("FAIL: cannot open %s\n", fname);
+		win_ring_free(ring);
+		delete ring;
+		return 1;
+	}
+
+	feed_arg_t args[RING_MAX_CONS];
+	std::thread threads[RING_MAX_CONS];
+
+	win_ring_start(ring);
+	auto t_end = std::chrono::steady_clock::now() + std::chrono::milliseconds(ms);
+	for (i = 0; i < ncons; i++) {
+		args[i].ring = ring;
+		args[i].src = &src;
+		args[i].cons = i;
+		args[i].rate = rate;
+		args[i].errors = 0;
+		threads[i] = std::thread(feed_consume, &args[i], t_end);
+	}
+	for (i = 0; i < ncons; i++) {
+		threads[i].join();
+	}
+	win_ring_stop(ring);
+
+	ring_stats_t st;
+	win_ring_stats(ring, &st);
+
+	long long errors = 0;
+	fprintf(fout, "{\n  \"source\": \"%s\",\n  \"nphase\": %d,\n  \"nwidth\": %d,\n",
+		(src.win_type == WIN_EMPTY) ? "dds" : win_name(src.win_type), src.cfg.nphase, src.cfg.nwidth);
+	fprintf(fout, "  \"nblocks\": %d,\n  \"block\": %d,\n  \"time_ms\": %d,\n", nblocks, block, ms);
+	fprintf(fout, "  \"produced\": %lld,\n  \"producer_waits\": %lld,\n  \"producer_lag\": %lld,\n",
+		st.produced, st.waits, st.lag);
+	fprintf(fout, "  \"msps\": %.3f,\n  \"consumers\": [\n", (double)st.produced * block / ms / 1000.0);
+	for (i = 0; i < ncons; i++) {
+		fprintf(fout, "    {\"consumed\": %lld, \"underruns\": %lld, \"errors\": %lld}%s\n",
+			st.consumed[i], st.underruns[i], args[i].errors, (i + 1 < ncons) ? "," : "");
+		errors += args[i].errors;
+	}
+	fprintf(fout, "  ]\n}\n");
+	if (fname) {
+		fclose(fout);
+	}
+
+	win_ring_free(ring);
+	delete ring;
+
+	if (errors) {
+		printf("FAIL: %lld wrong samples or blocks\n", errors);
+		return 1;
+	}
+	printf("PASS: %lld blocks, %d consumers\n", st.produced, ncons);
+	return 0;
+}
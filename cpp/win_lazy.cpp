@@ -0,0 +1,457 @@
+/*******************************************************************************
+--
+-- Title       : win_lazy.cpp
+-- Design      : Lazy tiled window view
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Reader pins tile (pins + 1) and then checks state READY, evictor moves
+--               tile READY -> EVICT and then checks pins: with sequentially consistent
+--               atomics one of them sees the other, so pinned tile is never freed. State
+--               changes of build and eviction are notified under lock (no lost wakeups).
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "win_lazy.h"
+
+static inline long long tile_size (
+		const win_lazy_t *lazy
+	)
+{
+	return 1LL << lazy->tile_bits;
+}
+
+static void lazy_set (
+		win_lazy_t *lazy,
+		lazy_tile_t *tile,
+		int state
+	)
+{
+	tile->state.store(state);
+	std::lock_guard<std::mutex> guard(lazy->lock);
+	lazy->built.notify_all();
+}
+
+/* ---- Free cold tiles (LRU, not pinned) down to budget, except tile 'keep' --- */
+static void lazy_evict (
+		win_lazy_t *lazy,
+		long long keep
+	)
+{
+	std::lock_guard<std::mutex> guard(lazy->lock);
+
+	long long pass;
+	for (pass = 0; (pass < lazy->ntiles) && (lazy->resident.load() > lazy->budget); pass++) {
+		lazy_tile_t *cold = NULL;
+		long long t;
+		for (t = 0; t < lazy->ntiles; t++) {
+			lazy_tile_t *cur = &lazy->tiles[t];
+			if ((t == keep) || (cur->state.load() != TILE_READY) || (cur->pins.load() != 0)) {
+				continue;
+			}
+			if (!cold || (cur->stamp.load() < cold->stamp.load())) {
+				cold = cur;
+			}
+		}
+		if (!cold) {
+			break;
+		}
+
+		int expect = TILE_READY;
+		if (!cold->state.compare_exchange_strong(expect, TILE_EVICT)) {
+			continue;
+		}
+		if (cold->pins.load() != 0) {
+			cold->state.store(TILE_READY);
+			cold->stamp.store(lazy->clock++);
+			continue;
+		}
+		free(cold->data);
+		cold->data = NULL;
+		cold->state.store(TILE_EMPTY);
+		lazy->resident--;
+		lazy->evicted++;
+		lazy->built.notify_all();
+	}
+}
+
+/* ---- Generate tile in state BUILD, 0 - ok, 1 - no memory (tile is EMPTY again) --- */
+static int lazy_build (
+		win_lazy_t *lazy,
+		long long t
+	)
+{
+	lazy_tile_t *tile = &lazy->tiles[t];
+	const long long size = tile_size(lazy);
+
+	tile->data = (long long *)aligned_alloc(64, size * sizeof(long long));
+	if (!tile->data) {
+		lazy->fails++;
+		lazy_set(lazy, tile, TILE_EMPTY);
+		return 1;
+	}
+	win_model_block(&lazy->cfg, lazy->win_type, t * size, size, tile->data);
+	tile->stamp.store(lazy->clock++);
+	lazy->builds++;
+
+	long long res = ++lazy->resident;
+	long long peak = lazy->peak.load();
+	while ((res > peak) && !lazy->peak.compare_exchange_weak(peak, res)) {
+	}
+	lazy_set(lazy, tile, TILE_READY);
+
+	if (lazy->budget && (res > lazy->budget)) {
+		lazy_evict(lazy, t);
+	}
+	return 0;
+}
+
+/* ---- Ready tile: pinned data (pin = 1) or NULL (pin = 0, prefetch; no memory) --- */
+static const long long *lazy_get (
+		win_lazy_t *lazy,
+		long long t,
+		int pin
+	)
+{
+	lazy_tile_t *tile = &lazy->tiles[t];
+	int counted = 0;
+
+	for (;;) {
+		if (pin) {
+			tile->pins++;
+		}
+		int state = tile->state.load();
+		if (state == TILE_READY) {
+			if (!pin) {
+				return NULL;
+			}
+			tile->stamp.store(lazy->clock++);
+			if (!counted) {
+				lazy->hits++;
+			}
+			return tile->data;
+		}
+		if (pin) {
+			tile->pins--;
+		}
+
+		int expect = TILE_EMPTY;
+		if ((state == TILE_EMPTY) && tile->state.compare_exchange_strong(expect, TILE_BUILD)) {
+			if (lazy_build(lazy, t)) {
+				return NULL;
+			}
+			if (!pin) {
+				lazy->prefetched++;
+				return NULL;
+			}
+			if (!counted) {
+				lazy->misses++;
+			}
+			counted = 1;
+			continue;
+		}
+		if (!pin) {
+			return NULL;
+		}
+
+		// Build or eviction by other thread //
+		if (!counted) {
+			lazy->waits++;
+		}
+		counted = 1;
+		std::unique_lock<std::mutex> lk(lazy->lock);
+		lazy->built.wait(lk, [tile]() {
+			int st = tile->state.load();
+			return (st == TILE_READY) || (st == TILE_EMPTY);
+		});
+	}
+}
+
+static void lazy_worker (
+		win_lazy_t *lazy
+	)
+{
+	for (;;) {
+		long long t;
+		{
+			std::unique_lock<std::mutex> lk(lazy->lock);
+			lazy->queued.wait(lk, [lazy]() {
+				return lazy->stop || (lazy->qhead != lazy->qtail);
+			});
+			if (lazy->stop) {
+				return;
+			}
+			t = lazy->queue[lazy->qhead];
+			lazy->qhead = (lazy->qhead + 1) % LAZY_QUEUE;
+		}
+		lazy_get(lazy, t, 0);
+	}
+}
+
+static void lazy_push (
+		win_lazy_t *lazy,
+		long long t
+	)
+{
+	if (lazy->tiles[t].state.load() != TILE_EMPTY) {
+		return;
+	}
+	std::lock_guard<std::mutex> guard(lazy->lock);
+	int next = (lazy->qtail + 1) % LAZY_QUEUE;
+	if (next == lazy->qhead) {
+		return;
+	}
+	lazy->queue[lazy->qtail] = t;
+	lazy->qtail = next;
+	lazy->queued.notify_one();
+}
+
+/* ---- Sequential scan: previous access was the tile before --- */
+static void lazy_scan (
+		win_lazy_t *lazy,
+		long long t
+	)
+{
+	long long prev = lazy->last.exchange(t);
+	if (prev != ((t - 1) & (lazy->ntiles - 1))) {
+		return;
+	}
+	int k;
+	for (k = 1; k <= LAZY_AHEAD; k++) {
+		lazy_push(lazy, (t + k) & (lazy->ntiles - 1));
+	}
+}
+
+int win_lazy_init (
+		win_lazy_t *lazy,
+		const win_cfg_t *cfg,
+		int win_type,
+		int tile_bits,
+		long long budget
+	)
+{
+	if ((cfg->nphase < 4) || (cfg->nphase > 40) || (tile_bits < 4)) {
+		return 1;
+	}
+	if (tile_bits > cfg->nphase) {
+		tile_bits = cfg->nphase;
+	}
+
+	lazy->cfg = *cfg;
+	lazy->win_type = win_type;
+	lazy->tile_bits = tile_bits;
+	lazy->nsamples = 1LL << cfg->nphase;
+	lazy->ntiles = 1LL << (cfg->nphase - tile_bits);
+
+	// Budget in tiles, at least one tile //
+	const long long tile_bytes = tile_size(lazy) * (long long)sizeof(long long);
+	lazy->budget = (budget > 0) ? ((budget < tile_bytes) ? 1 : budget / tile_bytes) : 0;
+
+	lazy->tiles = new lazy_tile_t[lazy->ntiles];
+	long long t;
+	for (t = 0; t < lazy->ntiles; t++) {
+		lazy->tiles[t].state.store(TILE_EMPTY);
+		lazy->tiles[t].pins.store(0);
+		lazy->tiles[t].stamp.store(0);
+		lazy->tiles[t].data = NULL;
+	}
+
+	lazy->clock.store(0);
+	lazy->resident.store(0);
+	lazy->peak.store(0);
+	lazy->last.store(-2);
+	lazy->hits.store(0);
+	lazy->misses.store(0);
+	lazy->waits.store(0);
+	lazy->prefetched.store(0);
+	lazy->builds.store(0);
+	lazy->fails.store(0);
+	lazy->evicted.store(0);
+
+	lazy->qhead = 0;
+	lazy->qtail = 0;
+	lazy->stop = 0;
+	lazy->worker = std::thread(lazy_worker, lazy);
+	return 0;
+}
+
+void win_lazy_free (
+		win_lazy_t *lazy
+	)
+{
+	{
+		std::lock_guard<std::mutex> guard(lazy->lock);
+		lazy->stop = 1;
+		lazy->queued.notify_all();
+	}
+	if (lazy->worker.joinable()) {
+		lazy->worker.join();
+	}
+
+	long long t;
+	for (t = 0; t < lazy->ntiles; t++) {
+		free(lazy->tiles[t].data);
+	}
+	delete[] lazy->tiles;
+	lazy->tiles = NULL;
+}
+
+const long long *win_lazy_pin (
+		win_lazy_t *lazy,
+		long long tile
+	)
+{
+	return lazy_get(lazy, tile & (lazy->ntiles - 1), 1);
+}
+
+void win_lazy_unpin (
+		win_lazy_t *lazy,
+		long long tile
+	)
+{
+	lazy->tiles[tile & (lazy->ntiles - 1)].pins--;
+}
+
+int win_lazy_read (
+		win_lazy_t *lazy,
+		long long start,
+		long long count,
+		long long *out
+	)
+{
+	const long long size = tile_size(lazy);
+	while (count > 0) {
+		long long i = start & (lazy->nsamples - 1);
+		long long t = i >> lazy->tile_bits;
+		long long off = i & (size - 1);
+		long long len = (size - off < count) ? size - off : count;
+
+		lazy_scan(lazy, t);
+		const long long *dat = win_lazy_pin(lazy, t);
+		if (!dat) {
+			return 1;
+		}
+		memcpy(out, dat + off, len * sizeof(long long));
+		win_lazy_unpin(lazy, t);
+
+		start += len;
+		count -= len;
+		out += len;
+	}
+	return 0;
+}
+
+int win_lazy_stride (
+		win_lazy_t *lazy,
+		long long start,
+		long long step,
+		long long count,
+		long long *out
+	)
+{
+	const long long mask = tile_size(lazy) - 1;
+	const long long *dat = NULL;
+	long long cur = -1;
+
+	long long j;
+	for (j = 0; j < count; j++) {
+		long long i = (start + j * step) & (lazy->nsamples - 1);
+		long long t = i >> lazy->tile_bits;
+		if (t != cur) {
+			if (cur >= 0) {
+				win_lazy_unpin(lazy, cur);
+			}
+			lazy_scan(lazy, t);
+			dat = win_lazy_pin(lazy, t);
+			cur = t;
+			if (!dat) {
+				return 1;
+			}
+		}
+		out[j] = dat[i & mask];
+	}
+	if (cur >= 0) {
+		win_lazy_unpin(lazy, cur);
+	}
+	return 0;
+}
+
+int win_lazy_at (
+		win_lazy_t *lazy,
+		long long i,
+		long long *out
+	)
+{
+	return win_lazy_read(lazy, i, 1, out);
+}
+
+void win_lazy_prefetch (
+		win_lazy_t *lazy,
+		long long start,
+		long long count
+	)
+{
+	if (count <= 0) {
+		return;
+	}
+	long long first = (start & (lazy->nsamples - 1)) >> lazy->tile_bits;
+	long long num = ((start & (tile_size(lazy) - 1)) + count + tile_size(lazy) - 1) >> lazy->tile_bits;
+	if (num > lazy->ntiles) {
+		num = lazy->ntiles;
+	}
+	long long k;
+	for (k = 0; k < num; k++) {
+		lazy_push(lazy, (first + k) & (lazy->ntiles - 1));
+	}
+}
+
+void win_lazy_stats (
+		win_lazy_t *lazy,
+		lazy_stats_t *stats
+	)
+{
+	stats->ntiles = lazy->ntiles;
+	stats->resident = lazy->resident.load();
+	stats->peak = lazy->peak.load();
+	stats->hits = lazy->hits.load();
+	stats->misses = lazy->misses.load();
+	stats->waits = lazy->waits.load();
+	stats->prefetched = lazy->prefetched.load();
+	stats->builds = lazy->builds.load();
+	stats->fails = lazy->fails.load();
+	stats->evicted = lazy->evicted.load();
+}
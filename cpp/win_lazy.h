@@ -0,0 +1,181 @@
+/*******************************************************************************
+--
+-- Title       : win_lazy.h
+-- Design      : Lazy tiled window view
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Window of 2^NPHASE samples divided into tiles of 2^tile_bits samples. Tile
+--               is generated (cpp/win_model) on first access, concurrent readers of the
+--               same tile wait for one build. Sequential scan prefetches next tiles on a
+--               background thread, cold tiles are evicted (LRU) under memory budget. Tiles
+--               in use are pinned and never evicted.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef WIN_LAZY_H
+#define WIN_LAZY_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "win_model.h"
+
+/* ---- Default tile size: 2^LAZY_TILE_BITS samples --- */
+#ifndef LAZY_TILE_BITS
+#define LAZY_TILE_BITS  16
+#endif
+
+/* ---- Sequential scan: tiles generated ahead of reader --- */
+#ifndef LAZY_AHEAD
+#define LAZY_AHEAD      2
+#endif
+
+/* ---- Prefetch queue (tiles) --- */
+#define LAZY_QUEUE      64
+
+/* ---- Tile state --- */
+#define TILE_EMPTY      0
+#define TILE_BUILD      1
+#define TILE_READY      2
+#define TILE_EVICT      3
+
+typedef struct {
+	std::atomic<int> state;
+	std::atomic<int> pins;         // readers of tile
+	std::atomic<long long> stamp;  // last access (LRU)
+	long long *data;
+} lazy_tile_t;
+
+/* ---- Statistics --- */
+typedef struct {
+	long long ntiles;
+	long long resident;    // generated tiles in memory
+	long long peak;        // maximum of resident
+	long long hits;        // tile was ready
+	long long misses;      // tile generated by reader
+	long long waits;       // reader waited for build by other thread
+	long long prefetched;  // tiles generated ahead
+	long long builds;      // all generated tiles (rebuilds after eviction too)
+	long long fails;       // tile memory not allocated
+	long long evicted;
+} lazy_stats_t;
+
+typedef struct {
+	win_cfg_t cfg;
+	int win_type;
+	int tile_bits;
+	long long nsamples;
+	long long ntiles;
+	long long budget;      // resident tiles limit, 0 - no limit
+	lazy_tile_t *tiles;
+
+	std::atomic<long long> clock;
+	std::atomic<long long> resident;
+	std::atomic<long long> peak;
+	std::atomic<long long> last;   // last tile of reader (scan detection)
+	std::atomic<long long> hits, misses, waits, prefetched, builds, fails, evicted;
+
+	std::mutex lock;               // waits for builds, eviction, prefetch queue
+	std::condition_variable built;
+	std::condition_variable queued;
+	long long queue[LAZY_QUEUE];
+	int qhead, qtail;
+	int stop;
+	std::thread worker;
+} win_lazy_t;
+
+/* ---- Window view: budget - memory limit in bytes (0 - no limit), 0 - ok, 1 - error --- */
+int win_lazy_init (
+	win_lazy_t *lazy,
+	const win_cfg_t *cfg,
+	int win_type,
+	int tile_bits,
+	long long budget
+);
+
+void win_lazy_free (
+	win_lazy_t *lazy
+);
+
+/* ---- Pin tile and return its samples (generated on first access),
+	NULL - no memory for tile (not pinned) --- */
+const long long *win_lazy_pin (
+	win_lazy_t *lazy,
+	long long tile
+);
+
+void win_lazy_unpin (
+	win_lazy_t *lazy,
+	long long tile
+);
+
+/* ---- Samples start, start+1, ... start+count-1 (mod N), 0 - ok, 1 - no memory --- */
+int win_lazy_read (
+	win_lazy_t *lazy,
+	long long start,
+	long long count,
+	long long *out
+);
+
+/* ---- Every step-th sample: out[j] = w[start + j*step], 0 - ok, 1 - no memory --- */
+int win_lazy_stride (
+	win_lazy_t *lazy,
+	long long start,
+	long long step,
+	long long count,
+	long long *out
+);
+
+int win_lazy_at (
+	win_lazy_t *lazy,
+	long long i,
+	long long *out
+);
+
+/* ---- Hint: tiles of samples start..start+count-1 will be read --- */
+void win_lazy_prefetch (
+	win_lazy_t *lazy,
+	long long start,
+	long long count
+);
+
+void win_lazy_stats (
+	win_lazy_t *lazy,
+	lazy_stats_t *stats
+);
+
+#endif
@@ -0,0 +1,209 @@
+/*******************************************************************************
+--
+-- Title       : win_master.cpp
+-- Design      : Any-length windows from one master table
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Master table is calculated once from golden (double precision) window.
+--               Sample n of N points: reflection n -> N-n for n > N/2, position in table
+--               u = n * 2^(MASTER_BITS+1) / N (integer part j and Q16 fraction t), value
+--               v = sum c_i(t) * tab[j-1+i] (cubic) or tab[j] + t*(tab[j+1]-tab[j]), then
+--               out = round(v * (2^(NWIDTH-shift)-1) / 2^30).
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdlib.h>
+#include <math.h>
+#include "win_master.h"
+
+/* ---- Division with rounding to nearest (den > 0) --- */
+static inline long long rdiv (
+		long long num,
+		long long den
+	)
+{
+	return (num >= 0) ? (num + den / 2) / den : -((-num + den / 2) / den);
+}
+
+/* ---- Index of half-window table with reflection: w(-x) = w(x), w(1/2+x) = w(1/2-x) --- */
+static inline int reflect (
+		long long idx,
+		long long size
+	)
+{
+	if (idx < 0) {
+		idx = -idx;
+	}
+	if (idx > size) {
+		idx = 2 * size - idx;
+	}
+	return (int)idx;
+}
+
+int win_master_init (
+		win_master_t *mst,
+		int win_type,
+		int nbits
+	)
+{
+	double coe[WIN_MAXTERM];
+	int shift;
+	int nterm = win_coeffs(win_type, coe, &shift);
+
+	mst->win_type = win_type;
+	mst->nbits = nbits;
+	mst->shift = shift;
+	mst->tab = NULL;
+	if ((nterm == 0) || (nbits < 2) || (nbits > 28)) {
+		return 1;
+	}
+
+	const long long size = 1LL << nbits;
+	double *gld = (double *)malloc((size + 1) * sizeof(double));
+	mst->tab = (int *)malloc((size + 1) * sizeof(int));
+	if (!gld || !mst->tab) {
+		free(gld);
+		win_master_free(mst);
+		return 1;
+	}
+
+	// Half of window with 2^(nbits+1) points: x = j / 2^(nbits+1), j = 0..2^nbits //
+	win_golden_block(win_type, 0, size + 1, 2 * size, gld);
+
+	long long j;
+	for (j = 0; j <= size; j++) {
+		mst->tab[j] = (int)llround(gld[j] * (double)(1LL << MASTER_FRAC));
+	}
+	free(gld);
+	return 0;
+}
+
+void win_master_free (
+		win_master_t *mst
+	)
+{
+	free(mst->tab);
+	mst->tab = NULL;
+}
+
+void win_master_block (
+		const win_master_t *mst,
+		long long nsamples,
+		int nwidth,
+		long long start,
+		long long count,
+		long long *out
+	)
+{
+	const long long size = 1LL << mst->nbits;
+	const long long scale = (1LL << (nwidth - mst->shift)) - 1;
+	const long long one = 1LL << MASTER_TFRAC;
+	const int *tab = mst->tab;
+
+	long long i;
+	for (i = 0; i < count; i++) {
+		long long n = (start + i) % nsamples;
+		if (2 * n > nsamples) {
+			n = nsamples - n;
+		}
+
+		// Position: u = n * 2^(nbits+1) / N //
+		long long num = n << (mst->nbits + 1);
+		long long j = num / nsamples;
+		long long t = ((num % nsamples) << MASTER_TFRAC) / nsamples;
+
+		long long v;
+#if (MASTER_ORDER == 1)
+		long long p0 = tab[reflect(j, size)];
+		long long p1 = tab[reflect(j + 1, size)];
+		v = p0 + rdiv((p1 - p0) * t, one);
+#else
+		long long p0 = tab[reflect(j - 1, size)];
+		long long p1 = tab[reflect(j, size)];
+		long long p2 = tab[reflect(j + 1, size)];
+		long long p3 = tab[reflect(j + 2, size)];
+
+		// Lagrange weights in Q30: t*(t-1)*(t-2) is Q48 //
+		const long long q = 1LL << (3 * MASTER_TFRAC - MASTER_FRAC);
+		long long tp = t + one;
+		long long tm = t - one;
+		long long t2 = t - 2 * one;
+		long long c0 = rdiv(-t * tm * t2, 6 * q);
+		long long c1 = rdiv(tp * tm * t2, 2 * q);
+		long long c2 = rdiv(-tp * t * t2, 2 * q);
+		long long c3 = rdiv(tp * t * tm, 6 * q);
+
+		v = rdiv(c0 * p0 + c1 * p1 + c2 * p2 + c3 * p3, 1LL << MASTER_FRAC);
+#endif
+		out[i] = rdiv(v * scale, 1LL << MASTER_FRAC);
+	}
+}
+
+double win_master_bound (
+		const win_master_t *mst,
+		int nwidth
+	)
+{
+	double coe[WIN_MAXTERM];
+	int shift;
+	int nterm = win_coeffs(mst->win_type, coe, &shift);
+
+	// Max of |w'|, |w''| and |w''''|: sum of a_k * (2*pi*k)^m //
+	double m1 = 0.0, m2 = 0.0, m4 = 0.0;
+	int k;
+	for (k = 1; k < nterm; k++) {
+		double wk = 2.0 * M_PI * k;
+		m1 += fabs(coe[k]) * wk;
+		m2 += fabs(coe[k]) * wk * wk;
+		m4 += fabs(coe[k]) * wk * wk * wk * wk;
+	}
+
+	const double h = 1.0 / (double)(1LL << (mst->nbits + 1));
+	const double lsb = 1.0 / (double)(1LL << MASTER_FRAC);
+	const double scale = (double)((1LL << (nwidth - shift)) - 1);
+
+#if (MASTER_ORDER == 1)
+	// Table (sum of weights 1), rounding of t*(p1-p0), interpolation //
+	double err = 0.5 * lsb + 0.5 * lsb + m2 * h * h / 8.0;
+#else
+	// Table (Lebesgue constant 1.25), 4 weights, sum, interpolation 3/128*h^4*w'''' //
+	double err = 1.25 * 0.5 * lsb + 4 * 0.5 * lsb + 0.5 * lsb + 3.0 / 128.0 * m4 * h * h * h * h;
+#endif
+	// Truncation of position t to MASTER_TFRAC bits //
+	err += m1 * h / (double)(1LL << MASTER_TFRAC);
+
+	// Final rounding to NWIDTH //
+	return 0.5 + err * scale;
+}
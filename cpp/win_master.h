@@ -0,0 +1,102 @@
+/*******************************************************************************
+--
+-- Title       : win_master.h
+-- Design      : Any-length windows from one master table
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : One master table per window type: half of the window (x = 0..1/2) in
+--               2^MASTER_BITS intervals, Q1.30 fixed point. Window of any length N and
+--               width NWIDTH is taken from the table by 4-point (cubic Lagrange) or linear
+--               fixed-point interpolation, scale is the same as in HLS win_function:
+--               w(x) * (2^(NWIDTH-shift) - 1).
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef WIN_MASTER_H
+#define WIN_MASTER_H
+
+#include "win_model.h"
+
+/* ---- Master table: 2^MASTER_BITS intervals on half of the window --- */
+#ifndef MASTER_BITS
+#define MASTER_BITS   20
+#endif
+
+/* ---- Table values and interpolation coefficients: Q1.30 --- */
+#define MASTER_FRAC   30
+
+/* ---- Fraction of position between table points --- */
+#define MASTER_TFRAC  16
+
+/* ---- Interpolation: 1 - linear, 3 - cubic --- */
+#ifndef MASTER_ORDER
+#define MASTER_ORDER  3
+#endif
+
+typedef struct {
+	int win_type;
+	int nbits;         // 2^nbits intervals on x = 0..1/2
+	int shift;         // scale of HLS window: 2^(NWIDTH-shift) - 1
+	int *tab;          // 2^nbits + 1 points
+} win_master_t;
+
+/* ---- Build master table: 0 - ok, 1 - error --- */
+int win_master_init (
+	win_master_t *mst,
+	int win_type,
+	int nbits
+);
+
+void win_master_free (
+	win_master_t *mst
+);
+
+/* ---- Samples start, start+1, ... start+count-1 of window with N points --- */
+void win_master_block (
+	const win_master_t *mst,
+	long long nsamples,
+	int nwidth,
+	long long start,
+	long long count,
+	long long *out
+);
+
+/* ---- Max error (LSB of NWIDTH) versus exact window of the same scale --- */
+double win_master_bound (
+	const win_master_t *mst,
+	int nwidth
+);
+
+#endif
@@ -0,0 +1,132 @@
+/*******************************************************************************
+--
+-- Title       : win_metrics.cpp
+-- Design      : Window functions: closed-form metrics
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Coherent gain, processing gain, ENBW and scalloping loss of
+--               cosine-sum windows in O(K) from coefficients a0..aK and N.
+--               
+--               For periodic window of N samples (N > 2K):
+--                 sum(w)   = N * a0
+--                 sum(w^2) = N * (a0^2 + sum(ak^2) / 2)
+--                 W(1/2 bin) by geometric series of half-integer frequency.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <math.h>
+#include "win_metrics.h"
+#include "win_model.h"
+
+/* ---- Sum of exp(j*2*pi*m*n/N), n = 0..N-1, m is half-integer --- */
+static void half_sum (
+		double m,
+		long long nsamples,
+		double *re,
+		double *im
+	)
+{
+	// 2 / (1 - exp(j*phi)) //
+	double phi = 2.0 * M_PI * m / nsamples;
+	double dre = 1.0 - cos(phi);
+	double dim = -sin(phi);
+	double mag = dre * dre + dim * dim;
+	*re = 2.0 * dre / mag;
+	*im = -2.0 * dim / mag;
+}
+
+void win_coe_metrics (
+		const double *coe,
+		int nterm,
+		long long nsamples,
+		int nwidth,
+		int shift,
+		win_gain_t *met
+	)
+{
+	const double scale = pow(2.0, nwidth-shift) - 1.0;
+
+	double sum = 0.0;
+	double sum2 = 0.0;
+	double wmax = 0.0;
+	double hre = 0.0;
+	double him = 0.0;
+
+	int k;
+	for (k = 0; k < nterm; k++) {
+		double a = (nwidth > 0) ? round(coe[k] * scale) / scale : coe[k];
+		double sre, sim, tre, tim;
+
+		if (k == 0) {
+			sum = a;
+			sum2 = a * a;
+			half_sum(-0.5, nsamples, &hre, &him);
+			hre *= a;
+			him *= a;
+		} else {
+			sum2 += 0.5 * a * a;
+
+			// cos = (exp(+j) + exp(-j)) / 2 at half bin offset //
+			half_sum(k - 0.5, nsamples, &sre, &sim);
+			half_sum(-k - 0.5, nsamples, &tre, &tim);
+
+			a = (k & 1) ? -a : a;
+			hre += 0.5 * a * (sre + tre);
+			him += 0.5 * a * (sim + tim);
+		}
+		// Peak of cosine-sum at N/2: all terms are added //
+		wmax += fabs(a);
+	}
+
+	met->cgain = (wmax > 0.0) ? sum / wmax : 0.0;
+	met->enbw = (sum != 0.0) ? sum2 / (sum * sum) : 0.0;
+	met->pgain = (met->enbw > 0.0) ? 1.0 / met->enbw : 0.0;
+	met->ploss = (met->enbw > 0.0) ? 10.0 * log10(met->enbw) : 0.0;
+	met->scallop = (sum != 0.0) ? -20.0 * log10(sqrt(hre * hre + him * him) / fabs(sum * nsamples)) : 0.0;
+}
+
+void win_type_metrics (
+		int win_type,
+		long long nsamples,
+		int nwidth,
+		win_gain_t *met
+	)
+{
+	double coe[WIN_MAXTERM];
+	int shift;
+	int nterm = win_coeffs(win_type, coe, &shift);
+
+	win_coe_metrics(coe, nterm, nsamples, nwidth, shift, met);
+}
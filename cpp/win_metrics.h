@@ -0,0 +1,75 @@
+/*******************************************************************************
+--
+-- Title       : win_metrics.h
+-- Design      : Window functions: closed-form metrics
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Coherent gain, processing gain, ENBW and scalloping loss of
+--               cosine-sum windows in O(K) from coefficients a0..aK and N
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef WIN_METRICS_H
+#define WIN_METRICS_H
+
+/* ---- Closed-form window metrics --- */
+typedef struct {
+	double cgain;   // Coherent gain: sum(w) / N / max(w)
+	double pgain;   // Processing gain: 1 / ENBW
+	double enbw;    // Equivalent noise bandwidth, bins
+	double ploss;   // Processing loss: 10*log10(ENBW), dB
+	double scallop; // Scalloping loss, dB
+} win_gain_t;
+
+/* ---- w = a0 - a1*cos + a2*cos2 - ..., nwidth = 0: exact coefficients,
+        otherwise coefficients are quantized as in win_function --- */
+void win_coe_metrics (
+	const double *coe,
+	int nterm,
+	long long nsamples,
+	int nwidth,
+	int shift,
+	win_gain_t *met
+);
+
+/* ---- Same for window type of win_function --- */
+void win_type_metrics (
+	int win_type,
+	long long nsamples,
+	int nwidth,
+	win_gain_t *met
+);
+
+#endif
@@ -0,0 +1,407 @@
+/*******************************************************************************
+--
+-- Title       : win_model.cpp
+-- Design      : Window functions: host model
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Bit-exact host model of HLS win_function with run-time widths.
+--               Every signal is wrapped to the width of its ap_int type in HLS.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <string.h>
+#include <math.h>
+#include "win_model.h"
+#include "win_tables.h"
+
+/* ---- Window names (coefficients and shift are in win_tables.h) --- */
+static const struct {
+	int type;
+	const char *name;
+} win_table[] = {
+	{ WIN_HAMMING, "Hamming"           },
+	{ WIN_HANN,    "Hann"              },
+	{ WIN_BH3,     "Blackman-Harris-3" },
+	{ WIN_BH4,     "Blackman-Harris-4" },
+	{ WIN_BH5,     "Blackman-Harris-5" },
+	{ WIN_BH7,     "Blackman-Harris-7" },
+};
+
+#define WIN_NTYPES (int)(sizeof(win_table) / sizeof(win_table[0]))
+
+int win_select (
+		const char *name
+	)
+{
+	int i;
+	for (i = 0; i < WIN_NTYPES; i++) {
+		if (strcmp(name, win_table[i].name) == 0) {
+			return win_table[i].type;
+		}
+	}
+	return WIN_EMPTY;
+}
+
+const char *win_name (
+		int win_type
+	)
+{
+	int i;
+	for (i = 0; i < WIN_NTYPES; i++) {
+		if (win_table[i].type == win_type) {
+			return win_table[i].name;
+		}
+	}
+	return "Empty";
+}
+
+int win_coeffs (
+		int win_type,
+		double *coe,
+		int *shift
+	)
+{
+	int k;
+	if ((win_type < 0) || (win_type > 7) || (WIN_NTERMS[win_type] == 0)) {
+		*shift = 1;
+		return 0;
+	}
+	for (k = 0; k < WIN_MAXTERM; k++) {
+		coe[k] = WIN_COE[win_type][k];
+	}
+	*shift = WIN_SHIFT[win_type];
+	return WIN_NTERMS[win_type];
+}
+
+void win_cordic (
+		const win_cfg_t *cfg,
+		long long phi,
+		long long *out_cos,
+		long long *out_sin
+	)
+{
+	win_sc_t sc = win_cordic_sc(cfg->nphase, cfg->nwidth, cfg->nprec, cfg->niter, phi);
+	*out_cos = sc.c;
+	*out_sin = sc.s;
+}
+
+/* ---- Integer coefficients a[k] = round(coe[k] * (2^(NWIDTH-shift) - 1)) --- */
+static int model_coeffs (
+		const win_cfg_t *cfg,
+		int win_type,
+		long long *a,
+		int *shift
+	)
+{
+	double coe[WIN_MAXTERM];
+	int nterm = win_coeffs(win_type, coe, shift);
+	const double scale = pow(2.0, cfg->nwidth - *shift) - 1.0;
+
+	int k;
+	for (k = 0; k < nterm; k++) {
+		a[k] = (long long)round(coe[k] * scale);
+	}
+	return nterm;
+}
+
+static void model_block (
+		const win_cfg_t *cfg,
+		const long long *a,
+		int nterm,
+		long long start,
+		long long count,
+		long long *out
+	)
+{
+	const int nwidth = cfg->nwidth;
+
+	long long n;
+	int k;
+	for (n = 0; n < count; n++) {
+		if (nterm == 0) {
+			out[n] = 0x0;
+			continue;
+		}
+
+		long long i = win_wrap(start + n, cfg->nphase);
+		long long c, s;
+		long long sum = a[0];
+
+		for (k = 1; k < nterm; k++) {
+			win_cordic(cfg, k * i, &c, &s);
+			long long mlt = (long long)(((__int128)a[k] * c) >> (nwidth-2));
+
+			sum += (k & 1) ? -mlt : mlt;
+		}
+		out[n] = win_wrap(sum, nwidth);
+	}
+}
+
+void win_model_block (
+		const win_cfg_t *cfg,
+		int win_type,
+		long long start,
+		long long count,
+		long long *out
+	)
+{
+	long long a[WIN_MAXTERM];
+	int shift;
+	int nterm = model_coeffs(cfg, win_type, a, &shift);
+
+	model_block(cfg, a, nterm, start, count, out);
+}
+
+/* ---- Chunk conversion: straight loops without branches (vectorized) --- */
+static void model_convert (
+		const long long *src,
+		int count,
+		int nwidth,
+		int shift,
+		float *dst
+	)
+{
+	const float inv = (float)(1.0 / (pow(2.0, nwidth - shift) - 1.0));
+	int n;
+	for (n = 0; n < count; n++) {
+		dst[n] = (float)src[n] * inv;
+	}
+}
+
+static void model_convert (
+		const long long *src,
+		int count,
+		int nwidth,
+		int shift,
+		double *dst
+	)
+{
+	const double inv = 1.0 / (pow(2.0, nwidth - shift) - 1.0);
+	int n;
+	for (n = 0; n < count; n++) {
+		dst[n] = (double)src[n] * inv;
+	}
+}
+
+/* ---- Integer: peak 2^(NWIDTH-shift) - 1 to full scale of type, round half up and saturate --- */
+template <typename T>
+static void model_rescale (
+		const long long *src,
+		int count,
+		int nwidth,
+		int shift,
+		T *dst
+	)
+{
+	const int bits = 8 * (int)sizeof(T);
+	const double vmax = (double)((1LL << (bits - 1)) - 1);
+	const double vmin = -vmax - 1.0;
+	const double scale = vmax / (pow(2.0, nwidth - shift) - 1.0);
+
+	int n;
+	for (n = 0; n < count; n++) {
+		double val = floor((double)src[n] * scale + 0.5);
+		val = (val > vmax) ? vmax : val;
+		val = (val < vmin) ? vmin : val;
+		dst[n] = (T)val;
+	}
+}
+
+static void model_convert (
+		const long long *src,
+		int count,
+		int nwidth,
+		int shift,
+		int16_t *dst
+	)
+{
+	model_rescale(src, count, nwidth, shift, dst);
+}
+
+static void model_convert (
+		const long long *src,
+		int count,
+		int nwidth,
+		int shift,
+		int32_t *dst
+	)
+{
+	model_rescale(src, count, nwidth, shift, dst);
+}
+
+template <typename T>
+void win_model_block_as (
+		const win_cfg_t *cfg,
+		int win_type,
+		long long start,
+		long long count,
+		T *out
+	)
+{
+	long long a[WIN_MAXTERM];
+	int shift;
+	int nterm = model_coeffs(cfg, win_type, a, &shift);
+
+	long long tmp[WIN_CHUNK];
+	long long pos;
+	for (pos = 0; pos < count; pos += WIN_CHUNK) {
+		int len = (count - pos < WIN_CHUNK) ? (int)(count - pos) : WIN_CHUNK;
+		model_block(cfg, a, nterm, start + pos, len, tmp);
+		model_convert(tmp, len, cfg->nwidth, shift, out + pos);
+	}
+}
+
+template void win_model_block_as<float> (const win_cfg_t *, int, long long, long long, float *);
+template void win_model_block_as<double> (const win_cfg_t *, int, long long, long long, double *);
+template void win_model_block_as<int16_t> (const win_cfg_t *, int, long long, long long, int16_t *);
+template void win_model_block_as<int32_t> (const win_cfg_t *, int, long long, long long, int32_t *);
+
+void win_model_deriv (
+		const win_cfg_t *cfg,
+		int win_type,
+		long long start,
+		long long count,
+		long long *win,
+		long long *dwin,
+		long long *twin
+	)
+{
+	long long a[WIN_MAXTERM];
+	int shift;
+	int nterm = model_coeffs(cfg, win_type, a, &shift);
+
+	const int nwidth = cfg->nwidth;
+	const long long half = 1LL << (cfg->nphase - 1);
+
+	long long n;
+	int k;
+	for (n = 0; n < count; n++) {
+		long long i = win_wrap(start + n, cfg->nphase);
+		long long c, s;
+		long long sum = (nterm > 0) ? a[0] : 0x0;
+		long long der = 0x0;
+
+		// w = a0 - a1*cos(x) + a2*cos(2x) - ..., dw/dx = a1*sin(x) - 2*a2*sin(2x) + ... //
+		for (k = 1; k < nterm; k++) {
+			win_cordic(cfg, k * i, &c, &s);
+			long long mlt_c = (long long)(((__int128)a[k] * c) >> (nwidth-2));
+			long long mlt_s = (long long)(((__int128)(k * a[k]) * s) >> (nwidth-2));
+
+			sum += (k & 1) ? -mlt_c : mlt_c;
+			der += (k & 1) ? mlt_s : -mlt_s;
+		}
+		sum = win_wrap(sum, nwidth);
+
+		if (win) {
+			win[n] = sum;
+		}
+		if (dwin) {
+			dwin[n] = der;
+		}
+		if (twin) {
+			twin[n] = ((i & (2 * half - 1)) - half) * sum;
+		}
+	}
+}
+
+long long win_model (
+		const win_cfg_t *cfg,
+		int win_type,
+		long long i
+	)
+{
+	long long out;
+	win_model_block(cfg, win_type, i, 1, &out);
+	return out;
+}
+
+void win_golden_block (
+		int win_type,
+		long long start,
+		long long count,
+		long long nsamples,
+		double *out
+	)
+{
+	double coe[WIN_MAXTERM];
+	int shift;
+	int nterm = win_coeffs(win_type, coe, &shift);
+
+	// Phase rotation by 2*pi/N, exact cos/sin every WIN_RESYNC samples //
+	const double cd = cos(2.0 * M_PI / nsamples);
+	const double sd = sin(2.0 * M_PI / nsamples);
+
+	double c1 = 1.0;
+	double s1 = 0.0;
+
+	long long n;
+	for (n = 0; n < count; n++) {
+		if ((n % WIN_RESYNC) == 0) {
+			double phi = 2.0 * M_PI * ((start + n) % nsamples) / nsamples;
+			c1 = cos(phi);
+			s1 = sin(phi);
+		}
+
+		// cos(k*x) = 2*cos(x)*cos((k-1)*x) - cos((k-2)*x) //
+		double ck = c1;
+		double ck1 = 1.0;
+		double sum = (nterm > 0) ? coe[0] : 0.0;
+
+		int k;
+		for (k = 1; k < nterm; k++) {
+			sum += (k & 1) ? -coe[k] * ck : coe[k] * ck;
+
+			double cn = 2.0 * c1 * ck - ck1;
+			ck1 = ck;
+			ck = cn;
+		}
+		out[n] = sum;
+
+		double cn = c1 * cd - s1 * sd;
+		s1 = s1 * cd + c1 * sd;
+		c1 = cn;
+	}
+}
+
+double win_golden (
+		int win_type,
+		long long i,
+		long long nsamples
+	)
+{
+	double out;
+	win_golden_block(win_type, i, 1, nsamples, &out);
+	return out;
+}
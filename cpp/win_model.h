@@ -0,0 +1,156 @@
+/*******************************************************************************
+--
+-- Title       : win_model.h
+-- Design      : Window functions: host model
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Bit-exact host model of HLS win_function with run-time widths
+--               (data width, phase width, CORDIC precision and iterations)
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef WIN_MODEL_H
+#define WIN_MODEL_H
+
+#include <stdint.h>
+
+/* ---- Window types: same numbers as in HLS win_function --- */
+#define WIN_EMPTY     0x0
+#define WIN_HAMMING   0x1
+#define WIN_HANN      0x2
+#define WIN_BH3       0x3
+#define WIN_BH4       0x4
+#define WIN_BH5       0x5
+#define WIN_BH7       0x7
+
+#define WIN_MAXTERM   7
+
+/* ---- Golden data: exact cos/sin every WIN_RESYNC samples --- */
+#define WIN_RESYNC    4096
+
+/* ---- Typed output: samples per chunk (converted while in L1 cache) --- */
+#define WIN_CHUNK     256
+
+/* ---- Fixed-point configuration (NPHASE, NWIDTH, NPREC, NITER) --- */
+typedef struct {
+	int nphase; // Phase (counter) width: window length = 2^nphase
+	int nwidth; // Output data width
+	int nprec;  // Extra CORDIC precision bits
+	int niter;  // CORDIC iterations (Taylor tail if less than nwidth)
+} win_cfg_t;
+
+/* ---- Window type by name ("Hamming", "Blackman-Harris-4" etc.) --- */
+int win_select (
+	const char *name
+);
+
+const char *win_name (
+	int win_type
+);
+
+/* ---- Cosine-sum coefficients: w = a0 - a1*cos + a2*cos2 - ... --- */
+int win_coeffs (
+	int win_type,
+	double *coe,
+	int *shift
+);
+
+/* ---- Sine and cosine as calculated by HLS cordic() --- */
+void win_cordic (
+	const win_cfg_t *cfg,
+	long long phi,
+	long long *out_cos,
+	long long *out_sin
+);
+
+/* ---- Window sample as calculated by HLS win_function() --- */
+long long win_model (
+	const win_cfg_t *cfg,
+	int win_type,
+	long long i
+);
+
+/* ---- Block of window samples: start, start+1, ... start+count-1 --- */
+void win_model_block (
+	const win_cfg_t *cfg,
+	int win_type,
+	long long start,
+	long long count,
+	long long *out
+);
+
+/* ---- Block of window samples as output type T:
+	float, double: window value (peak 1.0), sample / (2^(NWIDTH-shift) - 1)
+	int16_t, int32_t: sample * (2^(bits-1) - 1) / (2^(NWIDTH-shift) - 1), peak is full
+	scale of T for every window, rounded half up and saturated --- */
+template <typename T>
+void win_model_block_as (
+	const win_cfg_t *cfg,
+	int win_type,
+	long long start,
+	long long count,
+	T *out
+);
+
+/* ---- Window, derivative and time-ramped window in one pass (reassignment):
+	win = w[i], dwin = N/(2*pi) * dw/di (sines of the same CORDIC calls),
+	twin = (i - N/2) * w[i], N = 2^NPHASE. NULL output is skipped --- */
+void win_model_deriv (
+	const win_cfg_t *cfg,
+	int win_type,
+	long long start,
+	long long count,
+	long long *win,
+	long long *dwin,
+	long long *twin
+);
+
+/* ---- Window sample in double precision (golden data) --- */
+double win_golden (
+	int win_type,
+	long long i,
+	long long nsamples
+);
+
+/* ---- Block of golden samples by phase rotation and Chebyshev recurrence --- */
+void win_golden_block (
+	int win_type,
+	long long start,
+	long long count,
+	long long nsamples,
+	double *out
+);
+
+#endif
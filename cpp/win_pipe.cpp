@@ -0,0 +1,255 @@
+/*******************************************************************************
+--
+-- Title       : win_pipe.cpp
+-- Design      : Latency, throughput and resources of VHDL window cores
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Run cycle model of win_selector (cpp/vhd_pipe) for one configuration of
+--               generics: ENABLE pattern (clocks on : clocks off) drives the core, DT_WIN
+--               with DT_VLD is compared with bit-exact window samples (phase n+1 for n-th
+--               output) or with golden file of tb_golden. Result is JSON: pipeline stages,
+--               ENABLE -> DT_VLD latency, DSP48 and ROM, samples per clock and per second.
+--               
+--               Usage: win_pipe <PHI_WIDTH> <DAT_WIDTH> <WIN_TYPE> [-s CORDIC|TAYLOR]
+--                               [-l LUT_SIZE] [-x 7SERIES|ULTRA] [-e on:off] [-n samples]
+--                               [-f MHz] [-g golden.bin]
+--               Example: win_pipe 10 16 BH7TERM -e 3:1 -f 350
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vhd_pipe.h"
+
+/* ---- Golden file of tb_golden: "WGLD" + 16 words --- */
+#define GLD_WORDS  16
+
+static long long get_word (
+		const unsigned char *buf,
+		int bytes
+	)
+{
+	unsigned long long val = 0;
+	int i;
+	for (i = 0; i < bytes; i++) {
+		val |= (unsigned long long)buf[i] << (8 * i);
+	}
+	// Sign extension //
+	return (long long)(val << (64 - 8 * bytes)) >> (64 - 8 * bytes);
+}
+
+/* ---- Read samples of golden file, returns number of samples or 0 --- */
+static long long read_golden (
+		const char *fname,
+		const vhd_cfg_t *cfg,
+		long long **out
+	)
+{
+	FILE *fin = fopen(fname, "rb");
+	if (!fin) {
+		return 0;
+	}
+
+	unsigned char hdr[4 + 4 * GLD_WORDS];
+	long long count = 0;
+	if ((fread(hdr, 1, sizeof(hdr), fin) == sizeof(hdr)) && (memcmp(hdr, "WGLD", 4) == 0)) {
+		int pw = (int)get_word(&hdr[8], 4);
+		int dw = (int)get_word(&hdr[12], 4);
+		int wt = (int)get_word(&hdr[16], 4);
+		if ((pw == cfg->phi_width) && (dw == cfg->dat_width) && (wt == cfg->win_type)) {
+			count = get_word(&hdr[32], 4);
+		}
+	}
+
+	int bytes = (cfg->dat_width + 7) / 8;
+	unsigned char *buf = (unsigned char *)malloc(count * bytes + 1);
+	if (count && (fread(buf, bytes, count, fin) == (size_t)count)) {
+		*out = (long long *)malloc(count * sizeof(long long));
+		long long i;
+		for (i = 0; i < count; i++) {
+			(*out)[i] = get_word(&buf[i * bytes], bytes);
+		}
+	} else {
+		count = 0;
+	}
+	free(buf);
+	fclose(fin);
+	return count;
+}
+
+int main (int argc, char **argv) {
+
+	if (argc < 4) {
+		printf("Usage: %s <PHI_WIDTH> <DAT_WIDTH> <WIN_TYPE> [-s CORDIC|TAYLOR] [-l LUT_SIZE] [-x 7SERIES|ULTRA] [-e on:off] [-n samples] [-f MHz] [-g golden.bin]\n", argv[0]);
+		return 1;
+	}
+
+	vhd_cfg_t cfg;
+	cfg.phi_width = atoi(argv[1]);
+	cfg.dat_width = atoi(argv[2]);
+	cfg.win_type = vhd_win_select(argv[3]);
+	cfg.sin_type = VHD_CORDIC;
+	cfg.lut_size = 9;
+	cfg.xseries = VHD_ULTRA;
+
+	int ena_on = 1;
+	int ena_off = 0;
+	long long nsamples = 0;
+	double fclk = 250.0;
+	const char *gname = NULL;
+
+	int i;
+	for (i = 4; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-s") == 0) {
+			cfg.sin_type = (strcmp(argv[i+1], "TAYLOR") == 0) ? VHD_TAYLOR : VHD_CORDIC;
+		} else if (strcmp(argv[i], "-l") == 0) {
+			cfg.lut_size = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-x") == 0) {
+			cfg.xseries = (strcmp(argv[i+1], "7SERIES") == 0) ? VHD_7SERIES : VHD_ULTRA;
+		} else if (strcmp(argv[i], "-e") == 0) {
+			sscanf(argv[i+1], "%d:%d", &ena_on, &ena_off);
+		} else if (strcmp(argv[i], "-n") == 0) {
+			nsamples = atoll(argv[i+1]);
+		} else if (strcmp(argv[i], "-f") == 0) {
+			fclk = atof(argv[i+1]);
+		} else if (strcmp(argv[i], "-g") == 0) {
+			gname = argv[i+1];
+		}
+	}
+	if (cfg.sin_type == VHD_CORDIC) {
+		cfg.lut_size = 0;
+	}
+	if (vhd_check(&cfg)) {
+		fprintf(stderr, "FAIL: configuration is not supported by RTL\n");
+		return 1;
+	}
+	if ((ena_on < 1) || (ena_off < 0)) {
+		fprintf(stderr, "FAIL: wrong ENABLE pattern\n");
+		return 1;
+	}
+	if (nsamples < 1) {
+		nsamples = 1LL << cfg.phi_width;
+	}
+
+	long long aa[WIN_MAXTERM];
+	vhd_coeffs(&cfg, aa);
+
+	// Reference: golden file or window samples for phase n+1. Without golden file
+	// both pipeline and reference use vhd_model: self-check of alignment only //
+	long long *gold = NULL;
+	long long ngold = 0;
+	if (gname) {
+		ngold = read_golden(gname, &cfg, &gold);
+		if (!ngold) {
+			fprintf(stderr, "FAIL: cannot read golden file %s for this configuration\n", gname);
+			return 1;
+		}
+	}
+
+	vhd_stages_t st;
+	vhd_usage_t use;
+	vhd_stages(&cfg, &st);
+	vhd_usage(&cfg, &use);
+
+	vhd_pipe_t pipe;
+	if (vhd_pipe_init(&pipe, &cfg, aa)) {
+		fprintf(stderr, "FAIL: cannot allocate pipeline\n");
+		return 1;
+	}
+
+	// Clocks: ENABLE pattern until the last sample comes to the output //
+	const long long mask = (1LL << cfg.phi_width) - 1;
+	long long nclk = 0, nout = 0, nerr = 0, nskew = 0;
+	long long first_vld = -1;
+	while (nout < nsamples) {
+		int enable = ((nclk % (ena_on + ena_off)) < ena_on) ? 1 : 0;
+		long long dt_win;
+		int dt_vld;
+		vhd_pipe_clock(&pipe, enable, &dt_win, &dt_vld);
+		if (dt_vld) {
+			if (first_vld < 0) {
+				first_vld = nclk;
+			}
+			long long win = vhd_window(&cfg, aa, (nout + VHD_PHASE0) & mask);
+			long long ref = gold ? gold[nout % ngold] : win;
+			nerr += (dt_win != ref) ? 1 : 0;
+			// Harmonic generators with different delays: output depends on ENABLE pattern //
+			nskew += (dt_win != win) ? 1 : 0;
+			nout++;
+		}
+		nclk++;
+	}
+	vhd_pipe_free(&pipe);
+
+	double rate = (double)nout / (double)(nclk - first_vld);
+
+	printf("{\n");
+	printf("  \"generics\": {\"PHI_WIDTH\": %d, \"DAT_WIDTH\": %d, \"WIN_TYPE\": \"%s\", \"SIN_TYPE\": \"%s\", \"LUT_SIZE\": %d, \"XSERIES\": \"%s\"},\n",
+		cfg.phi_width, cfg.dat_width, vhd_win_name(cfg.win_type), vhd_sin_name(cfg.sin_type), cfg.lut_size, vhd_xseries_name(cfg.xseries));
+	printf("  \"stages\": {\"sine\": %d, \"mult\": %d, \"round\": %d, \"adder\": %d, \"output\": %d},\n",
+		st.sine, st.mult, st.round, st.adder, st.output);
+	printf("  \"latency\": %d,\n", st.latency);
+	printf("  \"first_valid\": %lld,\n", first_vld);
+	printf("  \"dsp48\": {\"mult\": %d, \"adder\": %d, \"sine\": %d, \"total\": %d},\n",
+		use.dsp_mult, use.dsp_add, use.dsp_sine, use.dsp_total);
+	printf("  \"sincos\": %d,\n", use.sincos);
+	printf("  \"rom\": {\"bits\": %lld, \"style\": \"%s\"},\n", use.rom_bits, use.rom_bits ? (use.rom_block ? "block" : "distributed") : "none");
+	printf("  \"enable\": [%d, %d],\n", ena_on, ena_off);
+	printf("  \"clocks\": %lld,\n", nclk);
+	printf("  \"samples\": %lld,\n", nout);
+	printf("  \"samples_per_clock\": %.6f,\n", rate);
+	printf("  \"msps\": %.3f,\n", rate * fclk);
+	printf("  \"reference\": \"%s\",\n", gname ? gname : "self");
+	printf("  \"errors\": %lld,\n", nerr);
+	printf("  \"misaligned\": %lld\n", nskew);
+	printf("}\n");
+
+	if (gold) {
+		free(gold);
+	}
+	// Verdict to stderr: stdout is JSON only //
+	if (nerr) {
+		fprintf(stderr, "FAIL: %lld of %lld samples differ\n", nerr, nout);
+		return 1;
+	}
+	if (!gname) {
+		fprintf(stderr, "PASS: pipeline matches vhd_model samples (self-check, -g for golden file)\n");
+		return 0;
+	}
+	fprintf(stderr, "PASS: Data matches the golden output!\n");
+	return 0;
+}
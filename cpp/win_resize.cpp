@@ -0,0 +1,224 @@
+/*******************************************************************************
+--
+-- Title       : win_resize.cpp
+-- Design      : Any-length windows from one master table
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Build master table of window once (cpp/win_master) and take windows of
+--               every requested length from it. For each N: max error versus exact window
+--               of the same scale, error bound of interpolation, max difference with direct
+--               generation (bit-exact model of HLS win_function, N = 2^NPHASE only) and time
+--               of table gather and direct generation. Result is JSON.
+--               
+--               Usage: win_resize <window> <NWIDTH> <N1,N2,...> [-b MASTER_BITS] [-o result.json]
+--               Example: win_resize Blackman-Harris-4 24 1000,1024,4096,6000,65536
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <chrono>
+
+#include "win_master.h"
+#include "win_arena.h"
+
+/* ---- Maximum number of window lengths --- */
+#define RESIZE_MAX 256
+
+static double time_ns (
+		std::chrono::steady_clock::time_point start
+	)
+{
+	auto stop = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+int main (int argc, char **argv) {
+
+	if (argc < 4) {
+		printf("Usage: %s <window> <NWIDTH> <N1,N2,...> [-b MASTER_BITS] [-o result.json]\n", argv[0]);
+		return 1;
+	}
+
+	int win_type = win_select(argv[1]);
+	int nwidth = atoi(argv[2]);
+	int nbits = MASTER_BITS;
+	const char *fname = NULL;
+
+	long long lens[RESIZE_MAX];
+	int nlens = 0;
+	const char *ptr = argv[3];
+	while (ptr && *ptr && (nlens < RESIZE_MAX)) {
+		lens[nlens++] = atoll(ptr);
+		ptr = strchr(ptr, ',');
+		if (ptr) {
+			ptr++;
+		}
+	}
+
+	int i;
+	for (i = 4; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-b") == 0) {
+			nbits = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-o") == 0) {
+			fname = argv[i+1];
+		}
+	}
+	if ((win_type == WIN_EMPTY) || (nwidth < 4) || (nwidth > 32)) {
+		printf("FAIL: wrong window type or NWIDTH\n");
+		return 1;
+	}
+	for (i = 0; i < nlens; i++) {
+		if ((lens[i] < 4) || (lens[i] > (1LL << 32))) {
+			printf("FAIL: wrong window length %lld\n", lens[i]);
+			return 1;
+		}
+	}
+
+	// Arena for the longest window: table, golden and direct windows //
+	long long nmax = 0;
+	for (i = 0; i < nlens; i++) {
+		nmax = (lens[i] > nmax) ? lens[i] : nmax;
+	}
+	win_arena_t arena;
+	if (win_arena_init(&arena, nmax * (2 * sizeof(long long) + sizeof(double)) + 3 * ARENA_ALIGN, ARENA_HUGE)) {
+		printf("FAIL: cannot allocate %lld samples\n", nmax);
+		return 1;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	win_master_t mst;
+	if (win_master_init(&mst, win_type, nbits)) {
+		printf("FAIL: cannot build master table\n");
+		win_arena_free(&arena);
+		return 1;
+	}
+	double init_ns = time_ns(start);
+
+	FILE *fout = fname ? fopen(fname, "w") : stdout;
+	if (!fout) {
+		printf("FAIL: cannot open %s\n", fname);
+		win_master_free(&mst);
+		win_arena_free(&arena);
+		return 1;
+	}
+
+	const double bound = win_master_bound(&mst, nwidth);
+	const double scale = pow(2.0, nwidth - mst.shift) - 1.0;
+
+	fprintf(fout, "{\n  \"window\": \"%s\", \"nwidth\": %d, \"master_bits\": %d, \"order\": %d,\n",
+		win_name(win_type), nwidth, nbits, MASTER_ORDER);
+	fprintf(fout, "  \"master_bytes\": %lld, \"master_ms\": %.3f, \"bound_lsb\": %.6f,\n",
+		((1LL << nbits) + 1) * (long long)sizeof(int), init_ns * 1e-6, bound);
+	fprintf(fout, "  \"results\": [\n");
+
+	int fail = 0;
+	for (i = 0; i < nlens; i++) {
+		const long long nsamples = lens[i];
+		win_arena_reset(&arena);
+		long long *win = (long long *)win_arena_alloc(&arena, nsamples * sizeof(long long));
+		double *gld = (double *)win_arena_alloc(&arena, nsamples * sizeof(double));
+
+		start = std::chrono::steady_clock::now();
+		win_master_block(&mst, nsamples, nwidth, 0, nsamples, win);
+		double gather_ns = time_ns(start);
+
+		win_golden_block(win_type, 0, nsamples, nsamples, gld);
+
+		double max_err = 0.0;
+		long long n;
+		for (n = 0; n < nsamples; n++) {
+			double err = fabs((double)win[n] - gld[n] * scale);
+			if (err > max_err) {
+				max_err = err;
+			}
+		}
+		fail |= (max_err > bound) ? 1 : 0;
+
+		fprintf(fout, "    {\"n\": %lld, \"max_err\": %.6f, \"gather_ns\": %.3f", nsamples, max_err, gather_ns / nsamples);
+
+		// Direct generation: HLS win_function for N = 2^NPHASE //
+		if ((nsamples & (nsamples - 1)) == 0) {
+			win_cfg_t cfg;
+			cfg.nphase = 0;
+			while ((1LL << cfg.nphase) < nsamples) {
+				cfg.nphase++;
+			}
+			cfg.nwidth = nwidth;
+			cfg.nprec = 0;
+			cfg.niter = nwidth;
+
+			long long *dir = (long long *)win_arena_alloc(&arena, nsamples * sizeof(long long));
+			start = std::chrono::steady_clock::now();
+			win_model_block(&cfg, win_type, 0, nsamples, dir);
+			double direct_ns = time_ns(start);
+
+			long long max_diff = 0;
+			double max_dir = 0.0;
+			for (n = 0; n < nsamples; n++) {
+				long long diff = llabs(win[n] - dir[n]);
+				double err = fabs((double)dir[n] - gld[n] * scale);
+				if (diff > max_diff) {
+					max_diff = diff;
+				}
+				if (err > max_dir) {
+					max_dir = err;
+				}
+			}
+			fprintf(fout, ", \"direct_err\": %.6f, \"max_diff\": %lld, \"direct_ns\": %.3f",
+				max_dir, max_diff, direct_ns / nsamples);
+		}
+		fprintf(fout, "}%s\n", (i + 1 < nlens) ? "," : "");
+	}
+
+	arena_stats_t mem;
+	win_arena_stats(&arena, &mem);
+	fprintf(fout, "  ],\n  \"arena\": {\"bytes\": %zu, \"peak\": %zu, \"page\": \"%s\", \"thp_bytes\": %zu, \"node\": %d, \"allocs\": %lld}\n}\n",
+		mem.size, mem.peak, win_arena_page(mem.page), mem.thp_bytes, mem.node, mem.nallocs);
+	if (fname) {
+		fclose(fout);
+	}
+
+	win_master_free(&mst);
+	win_arena_free(&arena);
+	if (fail) {
+		printf("FAIL: error is more than bound %.6f LSB\n", bound);
+		return 1;
+	}
+	return 0;
+}
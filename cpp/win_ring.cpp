@@ -0,0 +1,225 @@
+/*******************************************************************************
+--
+-- Title       : win_ring.cpp
+-- Design      : Lock-free ring buffer for window and DDS streams
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Producer publishes block by release store of its write index, consumers
+--               read it by acquire load (and vice versa for read indices), so block data is
+--               visible without locks. Wait and underrun counters count events (a number of
+--               calls which found ring full / empty in a row is one event).
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdlib.h>
+#include "win_ring.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define RING_PAUSE() _mm_pause()
+#else
+#define RING_PAUSE() std::this_thread::yield()
+#endif
+
+static void idx_init (
+		ring_idx_t *idx
+	)
+{
+	idx->index.store(0, std::memory_order_relaxed);
+	idx->blocks.store(0, std::memory_order_relaxed);
+	idx->events.store(0, std::memory_order_relaxed);
+	idx->lag.store(0, std::memory_order_relaxed);
+	idx->wait = 0;
+}
+
+/* ---- Counter of one thread: relaxed increment without read-modify-write --- */
+static inline void cnt_inc (
+		std::atomic<long long> *cnt
+	)
+{
+	cnt->store(cnt->load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+int win_ring_init (
+		win_ring_t *ring,
+		int nblocks,
+		int block,
+		int ncons,
+		ring_gen_t gen,
+		void *ctx
+	)
+{
+	ring->data = NULL;
+	if ((nblocks < 2) || (nblocks & (nblocks - 1)) || (block < 1) || (ncons < 1) || (ncons > RING_MAX_CONS)) {
+		return 1;
+	}
+
+	ring->nblocks = nblocks;
+	ring->block = block;
+	ring->ncons = ncons;
+	ring->gen = gen;
+	ring->ctx = ctx;
+	ring->data = (long long *)aligned_alloc(RING_CACHE_LINE,
+		((size_t)nblocks * block * sizeof(long long) + RING_CACHE_LINE - 1) / RING_CACHE_LINE * RING_CACHE_LINE);
+	if (!ring->data) {
+		return 1;
+	}
+
+	idx_init(&ring->prod);
+	int i;
+	for (i = 0; i < RING_MAX_CONS; i++) {
+		idx_init(&ring->cons[i]);
+	}
+	ring->stop.store(0, std::memory_order_relaxed);
+	return 0;
+}
+
+void win_ring_free (
+		win_ring_t *ring
+	)
+{
+	win_ring_stop(ring);
+	free(ring->data);
+	ring->data = NULL;
+}
+
+int win_ring_produce (
+		win_ring_t *ring
+	)
+{
+	const long long wr = ring->prod.index.load(std::memory_order_relaxed);
+
+	// Backpressure: the slowest consumer holds the oldest block //
+	long long oldest = wr;
+	int i;
+	for (i = 0; i < ring->ncons; i++) {
+		long long rd = ring->cons[i].index.load(std::memory_order_acquire);
+		if (rd < oldest) {
+			oldest = rd;
+		}
+	}
+	if (wr - oldest >= ring->nblocks) {
+		if (!ring->prod.wait) {
+			cnt_inc(&ring->prod.events);
+			ring->prod.wait = 1;
+		}
+		return 0;
+	}
+	ring->prod.wait = 0;
+
+	long long *dst = &ring->data[(wr & (ring->nblocks - 1)) * (long long)ring->block];
+	ring->gen(ring->ctx, wr * ring->block, ring->block, dst);
+
+	// Producer lag: consumers are close to the write index //
+	if ((wr + 1 - oldest) * RING_LOW_MARK < ring->nblocks) {
+		cnt_inc(&ring->prod.lag);
+	}
+	cnt_inc(&ring->prod.blocks);
+	ring->prod.index.store(wr + 1, std::memory_order_release);
+	return 1;
+}
+
+int win_ring_start (
+		win_ring_t *ring
+	)
+{
+	ring->stop.store(0, std::memory_order_relaxed);
+	ring->thread = std::thread([ring]() {
+		while (!ring->stop.load(std::memory_order_relaxed)) {
+			if (!win_ring_produce(ring)) {
+				RING_PAUSE();
+			}
+		}
+	});
+	return 0;
+}
+
+void win_ring_stop (
+		win_ring_t *ring
+	)
+{
+	ring->stop.store(1, std::memory_order_relaxed);
+	if (ring->thread.joinable()) {
+		ring->thread.join();
+	}
+}
+
+const long long *win_ring_acquire (
+		win_ring_t *ring,
+		int cons,
+		long long *start
+	)
+{
+	ring_idx_t *idx = &ring->cons[cons];
+	const long long rd = idx->index.load(std::memory_order_relaxed);
+
+	if (rd >= ring->prod.index.load(std::memory_order_acquire)) {
+		if (!idx->wait) {
+			cnt_inc(&idx->events);
+			idx->wait = 1;
+		}
+		return NULL;
+	}
+	idx->wait = 0;
+
+	*start = rd * ring->block;
+	return &ring->data[(rd & (ring->nblocks - 1)) * (long long)ring->block];
+}
+
+void win_ring_release (
+		win_ring_t *ring,
+		int cons
+	)
+{
+	ring_idx_t *idx = &ring->cons[cons];
+	cnt_inc(&idx->blocks);
+	idx->index.store(idx->index.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void win_ring_stats (
+		win_ring_t *ring,
+		ring_stats_t *stats
+	)
+{
+	stats->produced = ring->prod.blocks.load(std::memory_order_relaxed);
+	stats->waits = ring->prod.events.load(std::memory_order_relaxed);
+	stats->lag = ring->prod.lag.load(std::memory_order_relaxed);
+
+	int i;
+	for (i = 0; i < RING_MAX_CONS; i++) {
+		stats->consumed[i] = ring->cons[i].blocks.load(std::memory_order_relaxed);
+		stats->underruns[i] = ring->cons[i].events.load(std::memory_order_relaxed);
+	}
+}
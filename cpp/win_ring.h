@@ -0,0 +1,155 @@
+/*******************************************************************************
+--
+-- Title       : win_ring.h
+-- Design      : Lock-free ring buffer for window and DDS streams
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Single producer / multiple consumers ring of sample blocks. Producer thread
+--               fills blocks ahead of demand by generator function (window model, CORDIC
+--               DDS etc.), every consumer reads every block (own read index). Producer
+--               waits while the slowest consumer holds the oldest block (backpressure),
+--               consumers never wait: empty ring is an underrun. Indices are on separate
+--               cache lines, counters: produced blocks, producer waits for free block,
+--               producer lag (fill level below RING_LOW_MARK when block is published),
+--               consumed blocks and underruns of each consumer.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef WIN_RING_H
+#define WIN_RING_H
+
+#include <atomic>
+#include <thread>
+
+/* ---- Cache line size: padding of indices and counters --- */
+#ifndef RING_CACHE_LINE
+#define RING_CACHE_LINE  64
+#endif
+
+/* ---- Maximum number of consumers --- */
+#define RING_MAX_CONS    16
+
+/* ---- Producer lag: fill level (part of ring) below 1/RING_LOW_MARK --- */
+#define RING_LOW_MARK    4
+
+/* ---- Generator: samples start, start+1, ... start+count-1 of stream --- */
+typedef void (*ring_gen_t) (
+	void *ctx,
+	long long start,
+	long long count,
+	long long *out
+);
+
+/* ---- Index with counters on its own cache line --- */
+typedef struct alignas(RING_CACHE_LINE) {
+	std::atomic<long long> index;    // next block to write / read
+	std::atomic<long long> blocks;   // produced / consumed blocks
+	std::atomic<long long> events;   // producer: waits for free block, consumer: underruns
+	std::atomic<long long> lag;      // producer: blocks published with low fill level
+	int wait;                        // owner only: last call found ring full / empty
+} ring_idx_t;
+
+typedef struct {
+	int nblocks;       // ring size (power of 2)
+	int block;         // samples per block
+	int ncons;         // number of consumers
+	long long *data;   // nblocks * block samples
+
+	ring_gen_t gen;
+	void *ctx;
+
+	ring_idx_t prod;
+	ring_idx_t cons[RING_MAX_CONS];
+
+	std::atomic<int> stop;
+	std::thread thread;
+} win_ring_t;
+
+/* ---- Statistics of ring --- */
+typedef struct {
+	long long produced;
+	long long waits;
+	long long lag;
+	long long consumed[RING_MAX_CONS];
+	long long underruns[RING_MAX_CONS];
+} ring_stats_t;
+
+/* ---- Ring of nblocks (power of 2) blocks: 0 - ok, 1 - error --- */
+int win_ring_init (
+	win_ring_t *ring,
+	int nblocks,
+	int block,
+	int ncons,
+	ring_gen_t gen,
+	void *ctx
+);
+
+void win_ring_free (
+	win_ring_t *ring
+);
+
+/* ---- Producer: one block if ring is not full, returns 1 if block is written --- */
+int win_ring_produce (
+	win_ring_t *ring
+);
+
+/* ---- Producer thread: fill ring ahead of consumers until win_ring_stop() --- */
+int win_ring_start (
+	win_ring_t *ring
+);
+
+void win_ring_stop (
+	win_ring_t *ring
+);
+
+/* ---- Consumer: next block or NULL (underrun), first sample index in *start --- */
+const long long *win_ring_acquire (
+	win_ring_t *ring,
+	int cons,
+	long long *start
+);
+
+/* ---- Consumer: block from win_ring_acquire() is free --- */
+void win_ring_release (
+	win_ring_t *ring,
+	int cons
+);
+
+void win_ring_stats (
+	win_ring_t *ring,
+	ring_stats_t *stats
+);
+
+#endif
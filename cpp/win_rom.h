@@ -0,0 +1,120 @@
+/*******************************************************************************
+--
+-- Title       : win_rom.h
+-- Design      : Compile-time window ROM tables
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : constexpr model of HLS win_function (CORDIC and coefficients of win_tables.h,
+--               shared with cpp/win_model): win_rom<TYPE, NPHASE, NWIDTH>()
+--               gives std::array of 2^NPHASE window samples calculated by compiler, table
+--               of constexpr variable is placed to read-only data. Functions are usable at
+--               run time too (cpp/win_rom: VHDL and COE files from the same code).
+--               
+--               Requires C++17 (constexpr std::array::operator[]). Large tables need
+--               bigger constexpr limit: -fconstexpr-ops-limit (GCC), -fconstexpr-steps (Clang).
+--               
+--               Example: static constexpr auto win = win_rom<WIN_BH4, 10, 24>();
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef WIN_ROM_H
+#define WIN_ROM_H
+
+#include <array>
+#include <stdint.h>
+#include <type_traits>
+
+#include "win_model.h"
+#include "win_tables.h"
+
+/* ---- round() of positive and negative values --- */
+constexpr long long rom_round (
+		double val
+	)
+{
+	return (val >= 0.0) ? (long long)(val + 0.5) : -(long long)(-val + 0.5);
+}
+
+/* ---- Window sample as calculated by HLS win_function() --- */
+constexpr long long rom_sample (
+		int win_type,
+		int nphase,
+		int nwidth,
+		int nprec,
+		int niter,
+		long long i
+	)
+{
+	const int type = win_type & 0x7;
+	const int nterm = WIN_NTERMS[type];
+	if (nterm == 0) {
+		return 0x0;
+	}
+
+	const double scale = (double)((1LL << (nwidth - WIN_SHIFT[type])) - 1);
+
+	long long sum = rom_round(WIN_COE[type][0] * scale);
+	for (int k = 1; k < nterm; k++) {
+		long long a = rom_round(WIN_COE[type][k] * scale);
+		long long c = win_cordic_sc(nphase, nwidth, nprec, niter, k * win_wrap(i, nphase)).c;
+		long long mlt = (long long)(((__int128)a * c) >> (nwidth-2));
+
+		sum += (k & 1) ? -mlt : mlt;
+	}
+	return win_wrap(sum, nwidth);
+}
+
+/* ---- Smallest signed integer for NWIDTH bits --- */
+template <int NWIDTH>
+using rom_t = typename std::conditional<(NWIDTH <= 16), int16_t,
+              typename std::conditional<(NWIDTH <= 32), int32_t, int64_t>::type>::type;
+
+/* ---- Window of 2^NPHASE samples calculated at compile time --- */
+template <int TYPE, int NPHASE, int NWIDTH, int NPREC = 0, int NITER = NWIDTH>
+constexpr std::array<rom_t<NWIDTH>, (1 << NPHASE)> win_rom (
+	)
+{
+	static_assert(WIN_NTERMS[TYPE & 0x7] > 0, "win_rom: wrong window type");
+	static_assert((NPHASE >= 3) && (NPHASE <= 24), "win_rom: wrong NPHASE");
+	static_assert((NWIDTH >= 4) && (NWIDTH <= 40), "win_rom: wrong NWIDTH");
+
+	std::array<rom_t<NWIDTH>, (1 << NPHASE)> rom {};
+	for (long long i = 0; i < (1LL << NPHASE); i++) {
+		rom[i] = (rom_t<NWIDTH>)rom_sample(TYPE, NPHASE, NWIDTH, NPREC, NITER, i);
+	}
+	return rom;
+}
+
+#endif
@@ -0,0 +1,215 @@
+/*******************************************************************************
+--
+-- Title       : win_romgen.cpp
+-- Design      : Window ROM initialization files
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Window ROM for VHDL (package with constant array) or Xilinx COE file.
+--               Samples are calculated by constexpr functions of cpp/win_rom.h (the same
+--               code gives compile-time tables) and checked with cpp/win_model.
+--               
+--               Usage: win_romgen <window> <NPHASE> <NWIDTH> [-f vhd|coe] [-o file]
+--                                 [-n package] [-p NPREC] [-i NITER]
+--               Example: win_romgen Blackman-Harris-4 10 24 -f coe -o bh4_rom.coe
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "win_rom.h"
+
+/* ---- Compile-time table: checked with bit-exact model at run time --- */
+static constexpr auto ROM_CHECK = win_rom<WIN_BH7, 8, 24>();
+
+static void print_bin (
+		FILE *fout,
+		long long val,
+		int nwidth
+	)
+{
+	int b;
+	fprintf(fout, "\"");
+	for (b = nwidth - 1; b >= 0; b--) {
+		fprintf(fout, "%d", (int)((val >> b) & 1));
+	}
+	fprintf(fout, "\"");
+}
+
+static void write_vhd (
+		FILE *fout,
+		const char *pkg,
+		const char *name,
+		int nphase,
+		int nwidth,
+		const long long *rom
+	)
+{
+	const long long nsamples = 1LL << nphase;
+
+	fprintf(fout, "-------------------------------------------------------------------------------\n");
+	fprintf(fout, "--\n");
+	fprintf(fout, "-- Title       : %s\n", pkg);
+	fprintf(fout, "-- Design      : Blackman-Harris Windows\n");
+	fprintf(fout, "--\n");
+	fprintf(fout, "-- Description : %s window ROM, NPHASE = %d, NWIDTH = %d (win_romgen)\n", name, nphase, nwidth);
+	fprintf(fout, "--\n");
+	fprintf(fout, "-------------------------------------------------------------------------------\n");
+	fprintf(fout, "library ieee;\nuse ieee.std_logic_1164.all;\n\n");
+	fprintf(fout, "package %s is\n\n", pkg);
+	fprintf(fout, "\tconstant WIN_ROM_DEPTH\t: integer:=%lld;\n", nsamples);
+	fprintf(fout, "\tconstant WIN_ROM_WIDTH\t: integer:=%d;\n\n", nwidth);
+	fprintf(fout, "\ttype std_array_win is array (0 to WIN_ROM_DEPTH-1) of std_logic_vector(WIN_ROM_WIDTH-1 downto 0);\n\n");
+	fprintf(fout, "\tconstant WIN_ROM\t\t: std_array_win := (\n");
+
+	long long i;
+	for (i = 0; i < nsamples; i++) {
+		fprintf(fout, "%s", ((i % 4) == 0) ? "\t\t" : " ");
+		print_bin(fout, rom[i], nwidth);
+		fprintf(fout, "%s", (i + 1 < nsamples) ? "," : "");
+		if (((i % 4) == 3) || (i + 1 == nsamples)) {
+			fprintf(fout, "\n");
+		}
+	}
+	fprintf(fout, "\t);\n\nend %s;\n", pkg);
+}
+
+static void write_coe (
+		FILE *fout,
+		const char *name,
+		int nphase,
+		int nwidth,
+		const long long *rom
+	)
+{
+	const long long nsamples = 1LL << nphase;
+	const unsigned long long mask = (nwidth >= 64) ? ~0ULL : (1ULL << nwidth) - 1;
+	const int digits = (nwidth + 3) / 4;
+
+	fprintf(fout, "; %s window ROM, NPHASE = %d, NWIDTH = %d (win_romgen)\n", name, nphase, nwidth);
+	fprintf(fout, "memory_initialization_radix=16;\n");
+	fprintf(fout, "memory_initialization_vector=\n");
+
+	long long i;
+	for (i = 0; i < nsamples; i++) {
+		fprintf(fout, "%0*llX%s\n", digits, (unsigned long long)rom[i] & mask, (i + 1 < nsamples) ? "," : ";");
+	}
+}
+
+int main (int argc, char **argv) {
+
+	if (argc < 4) {
+		printf("Usage: %s <window> <NPHASE> <NWIDTH> [-f vhd|coe] [-o file] [-n package] [-p NPREC] [-i NITER]\n", argv[0]);
+		return 1;
+	}
+
+	int win_type = win_select(argv[1]);
+	win_cfg_t cfg;
+	cfg.nphase = atoi(argv[2]);
+	cfg.nwidth = atoi(argv[3]);
+	cfg.nprec = 0;
+	cfg.niter = cfg.nwidth;
+
+	const char *fmt = "vhd";
+	const char *fname = NULL;
+	const char *pkg = "win_rom_pkg";
+
+	int i;
+	for (i = 4; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-f") == 0) {
+			fmt = argv[i+1];
+		} else if (strcmp(argv[i], "-o") == 0) {
+			fname = argv[i+1];
+		} else if (strcmp(argv[i], "-n") == 0) {
+			pkg = argv[i+1];
+		} else if (strcmp(argv[i], "-p") == 0) {
+			cfg.nprec = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-i") == 0) {
+			cfg.niter = atoi(argv[i+1]);
+		}
+	}
+	if ((win_type == WIN_EMPTY) || (cfg.nphase < 3) || (cfg.nphase > 24) || (cfg.nwidth < 4) || (cfg.nwidth > 40)) {
+		printf("FAIL: wrong window type, NPHASE or NWIDTH\n");
+		return 1;
+	}
+	if ((cfg.niter < 1) || (cfg.niter > cfg.nwidth)) {
+		cfg.niter = cfg.nwidth;
+	}
+
+	// Compile-time table and constexpr functions at run time versus bit-exact model //
+	long long chk[ROM_CHECK.size()];
+	win_cfg_t chk_cfg = { 8, 24, 0, 24 };
+	win_model_block(&chk_cfg, WIN_BH7, 0, ROM_CHECK.size(), chk);
+
+	const long long nsamples = 1LL << cfg.nphase;
+	long long *rom = (long long *)malloc(nsamples * sizeof(long long));
+	long long *ref = (long long *)malloc(nsamples * sizeof(long long));
+	long long n;
+	for (n = 0; n < nsamples; n++) {
+		rom[n] = rom_sample(win_type, cfg.nphase, cfg.nwidth, cfg.nprec, cfg.niter, n);
+	}
+	win_model_block(&cfg, win_type, 0, nsamples, ref);
+
+	int fail = memcmp(rom, ref, nsamples * sizeof(long long)) ? 1 : 0;
+	for (n = 0; n < (long long)ROM_CHECK.size(); n++) {
+		fail |= (ROM_CHECK[n] != chk[n]) ? 1 : 0;
+	}
+	free(ref);
+	if (fail) {
+		printf("FAIL: constexpr window differs from win_model\n");
+		free(rom);
+		return 1;
+	}
+
+	FILE *fout = fname ? fopen(fname, "w") : stdout;
+	if (!fout) {
+		printf("FAIL: cannot open %s\n", fname);
+		free(rom);
+		return 1;
+	}
+	if (strcmp(fmt, "coe") == 0) {
+		write_coe(fout, win_name(win_type), cfg.nphase, cfg.nwidth, rom);
+	} else {
+		write_vhd(fout, pkg, win_name(win_type), cfg.nphase, cfg.nwidth, rom);
+	}
+	if (fname) {
+		fclose(fout);
+		printf("PASS: %s window, %lld x %d bits: %s\n", win_name(win_type), nsamples, cfg.nwidth, fname);
+	}
+
+	free(rom);
+	return 0;
+}
@@ -0,0 +1,235 @@
+/*******************************************************************************
+--
+-- Title       : win_serve.cpp
+-- Design      : Local window daemon: protocol and client
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Client side of window daemon: SOCK_SEQPACKET Unix socket (one message per
+--               request / reply), table descriptor comes in SCM_RIGHTS control message.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "win_serve.h"
+
+int win_serve_path (
+		char *path,
+		size_t size
+	)
+{
+	int len;
+#ifdef SERVE_PATH
+	len = snprintf(path, size, "%s", SERVE_PATH);
+#else
+	const char *dir = getenv("XDG_RUNTIME_DIR");
+	if (dir && (dir[0] == '/')) {
+		len = snprintf(path, size, "%s/%s", dir, SERVE_NAME);
+	} else {
+		len = snprintf(path, size, "/tmp/win_daemon-%u.sock", (unsigned)getuid());
+	}
+#endif
+	return ((len < 0) || ((size_t)len >= size)) ? 1 : 0;
+}
+
+int win_serve_connect (
+		const char *path
+	)
+{
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		return -1;
+	}
+	strcpy(addr.sun_path, path);
+
+	int sock = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+	if (sock < 0) {
+		return -1;
+	}
+	if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		close(sock);
+		return -1;
+	}
+
+	// Tables only from daemon of the same user: other user may bind the name first //
+	struct ucred cred;
+	socklen_t len = sizeof(cred);
+	if (getsockopt(sock, SOL_SOCKET, SO_PEERCRED, &cred, &len) || (cred.uid != getuid())) {
+		close(sock);
+		return -1;
+	}
+	return sock;
+}
+
+void win_serve_req (
+		serve_req_t *req,
+		int win_type,
+		long long nsamples,
+		int nwidth
+	)
+{
+	memset(req, 0, sizeof(serve_req_t));
+	req->magic = SERVE_MAGIC;
+	req->op = SERVE_GET;
+	req->win_type = win_type;
+	req->nsamples = nsamples;
+	req->nwidth = nwidth;
+}
+
+/* ---- Reply with optional descriptor: fd or -1 --- */
+static int serve_recv (
+		int sock,
+		void *buf,
+		size_t len,
+		int *fd
+	)
+{
+	union {
+		char buf[CMSG_SPACE(sizeof(int))];
+		struct cmsghdr align;
+	} ctl;
+	struct iovec iov = { buf, len };
+	struct msghdr msg;
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = ctl.buf;
+	msg.msg_controllen = sizeof(ctl.buf);
+
+	*fd = -1;
+	ssize_t ret = recvmsg(sock, &msg, MSG_CMSG_CLOEXEC);
+	if (ret < (ssize_t)sizeof(serve_rep_t)) {
+		return 1;
+	}
+	struct cmsghdr *cm = CMSG_FIRSTHDR(&msg);
+	if (cm && (cm->cmsg_level == SOL_SOCKET) && (cm->cmsg_type == SCM_RIGHTS)) {
+		memcpy(fd, CMSG_DATA(cm), sizeof(int));
+	}
+	return 0;
+}
+
+int win_serve_get (
+		int sock,
+		const serve_req_t *req,
+		serve_rep_t *rep,
+		const void **table
+	)
+{
+	*table = NULL;
+	if (send(sock, req, sizeof(serve_req_t), MSG_NOSIGNAL) != (ssize_t)sizeof(serve_req_t)) {
+		return 1;
+	}
+
+	int fd;
+	if (serve_recv(sock, rep, sizeof(serve_rep_t), &fd)) {
+		return 1;
+	}
+	if ((rep->magic != SERVE_MAGIC) || (rep->status != SERVE_OK) || (fd < 0) ||
+		((rep->elem != 4) && (rep->elem != 8)) || (rep->bytes != rep->nsamples * rep->elem)) {
+		if (fd >= 0) {
+			close(fd);
+		}
+		return 1;
+	}
+
+	// Mapping keeps segment alive after descriptor is closed //
+	void *ptr = mmap(NULL, rep->bytes, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (ptr == MAP_FAILED) {
+		return 1;
+	}
+	*table = ptr;
+	return 0;
+}
+
+long long win_serve_sample (
+		const serve_rep_t *rep,
+		const void *table,
+		long long n
+	)
+{
+	if (rep->elem == 4) {
+		return ((const int32_t *)table)[n];
+	}
+	return ((const long long *)table)[n];
+}
+
+void win_serve_unmap (
+		const void *table,
+		long long bytes
+	)
+{
+	if (table) {
+		munmap((void *)table, bytes);
+	}
+}
+
+int win_serve_stats (
+		int sock,
+		serve_stats_t *stats
+	)
+{
+	serve_req_t req;
+	memset(&req, 0, sizeof(req));
+	req.magic = SERVE_MAGIC;
+	req.op = SERVE_STATS;
+	if (send(sock, &req, sizeof(req), MSG_NOSIGNAL) != (ssize_t)sizeof(req)) {
+		return 1;
+	}
+
+	char buf[sizeof(serve_rep_t) + sizeof(serve_stats_t)];
+	int fd;
+	if (serve_recv(sock, buf, sizeof(buf), &fd)) {
+		return 1;
+	}
+	if (fd >= 0) {
+		close(fd);
+	}
+	serve_rep_t rep;
+	memcpy(&rep, buf, sizeof(rep));
+	if ((rep.magic != SERVE_MAGIC) || (rep.status != SERVE_OK)) {
+		return 1;
+	}
+	memcpy(stats, buf + sizeof(rep), sizeof(serve_stats_t));
+	return 0;
+}
@@ -0,0 +1,154 @@
+/*******************************************************************************
+--
+-- Title       : win_serve.h
+-- Design      : Local window daemon: protocol and client
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Requests to window daemon (cpp/win_daemon) over Unix domain socket: window
+--               type (or custom cosine-sum coefficients), length N and data width. Reply
+--               carries file descriptor of sealed shared-memory segment (memfd) with the
+--               table of int32 (NWIDTH <= 32) or int64 samples: client maps it read-only,
+--               no copy. Linux only.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef WIN_SERVE_H
+#define WIN_SERVE_H
+
+#include <stdint.h>
+
+#include "win_model.h"
+
+/* ---- Default socket: SERVE_NAME in $XDG_RUNTIME_DIR (per user), else
+	/tmp/win_daemon-<uid>.sock; SERVE_PATH overrides both --- */
+#define SERVE_NAME   "win_daemon.sock"
+
+#define SERVE_MAGIC  0x444E4957  // "WIND"
+
+/* ---- Operations --- */
+#define SERVE_GET    1
+#define SERVE_STATS  2
+
+/* ---- Reply status --- */
+#define SERVE_OK     0
+#define SERVE_EINVAL 1  // wrong request
+#define SERVE_ENOMEM 2  // cannot create table
+
+/* ---- Request: window of type win_type or custom coefficients (win_type = WIN_EMPTY):
+	w = coe[0] - coe[1]*cos(x) + coe[2]*cos(2x) - ..., scale 2^(NWIDTH-shift) - 1.
+	N = 2^k: bit-exact HLS model, other N: master table (cpp/win_master) --- */
+typedef struct {
+	int magic;
+	int op;
+	int win_type;
+	int nwidth;
+	long long nsamples;
+	int nterm;
+	int shift;
+	double coe[WIN_MAXTERM];
+} serve_req_t;
+
+typedef struct {
+	int magic;
+	int status;
+	int hit;               // table was in cache (or built by concurrent request)
+	int nwidth;
+	int elem;              // bytes per sample: 4 (int32, NWIDTH <= 32) or 8 (int64)
+	long long nsamples;
+	long long bytes;       // segment size: nsamples * elem
+	long long latency_ns;  // daemon time from request to reply
+} serve_rep_t;
+
+/* ---- Daemon metrics --- */
+typedef struct {
+	long long requests;
+	long long hits;        // ready table from cache
+	long long shared;      // waited for concurrent build of the same table
+	long long misses;      // table built
+	long long errors;
+	long long evicted;
+	long long tables;      // tables in cache
+	long long bytes;       // bytes of cached tables and tables being built
+	double lat_avg_ns;
+	double lat_max_ns;
+	double build_avg_ns;
+} serve_stats_t;
+
+/* ---- Default socket path: 0 - ok, 1 - path does not fit in size --- */
+int win_serve_path (
+	char *path,
+	size_t size
+);
+
+/* ---- Connect to daemon: socket or -1 (also if daemon runs as other user) --- */
+int win_serve_connect (
+	const char *path
+);
+
+/* ---- Get table: 0 - ok, *table is read-only mapping of rep->bytes,
+	rep->nsamples samples of rep->elem bytes (int32_t or int64_t) --- */
+int win_serve_get (
+	int sock,
+	const serve_req_t *req,
+	serve_rep_t *rep,
+	const void **table
+);
+
+/* ---- Sample n of table of any element size --- */
+long long win_serve_sample (
+	const serve_rep_t *rep,
+	const void *table,
+	long long n
+);
+
+void win_serve_unmap (
+	const void *table,
+	long long bytes
+);
+
+int win_serve_stats (
+	int sock,
+	serve_stats_t *stats
+);
+
+/* ---- Request of standard window --- */
+void win_serve_req (
+	serve_req_t *req,
+	int win_type,
+	long long nsamples,
+	int nwidth
+);
+
+#endif
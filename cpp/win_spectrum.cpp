@@ -0,0 +1,225 @@
+/*******************************************************************************
+--
+-- Title       : win_spectrum.cpp
+-- Design      : Window functions: spectral analysis
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : FFT, side-lobe level, ENBW, scalloping loss and SFDR
+--               of generated windows and sine waves
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "win_spectrum.h"
+
+void win_fft (
+		double *re,
+		double *im,
+		long long n
+	)
+{
+	long long i, j, k;
+
+	// Bit-reversal permutation //
+	for (i = 1, j = 0; i < n; i++) {
+		long long bit = n >> 1;
+		for (; j & bit; bit >>= 1) {
+			j ^= bit;
+		}
+		j ^= bit;
+		if (i < j) {
+			double tr = re[i]; re[i] = re[j]; re[j] = tr;
+			double ti = im[i]; im[i] = im[j]; im[j] = ti;
+		}
+	}
+
+	// Butterflies //
+	for (long long len = 2; len <= n; len <<= 1) {
+		double ang = -2.0 * M_PI / len;
+		for (k = 0; k < len / 2; k++) {
+			double wr = cos(ang * k);
+			double wi = sin(ang * k);
+			for (i = k; i < n; i += len) {
+				long long m = i + len / 2;
+				double xr = re[m] * wr - im[m] * wi;
+				double xi = re[m] * wi + im[m] * wr;
+				re[m] = re[i] - xr;
+				im[m] = im[i] - xi;
+				re[i] += xr;
+				im[i] += xi;
+			}
+		}
+	}
+}
+
+double win_sidelobe (
+		const double *win,
+		long long nsamples,
+		int pad
+	)
+{
+	long long nfft = nsamples * pad;
+	double *re = (double *)calloc(nfft, sizeof(double));
+	double *im = (double *)calloc(nfft, sizeof(double));
+
+	long long i;
+	for (i = 0; i < nsamples; i++) {
+		re[i] = win[i];
+	}
+	win_fft(re, im, nfft);
+
+	// Power spectrum: main lobe peak at DC //
+	for (i = 0; i <= nfft / 2; i++) {
+		re[i] = re[i] * re[i] + im[i] * im[i];
+	}
+
+	// Main lobe ends at the first local minimum //
+	long long kmin = 0;
+	while ((kmin < nfft / 2) && (re[kmin + 1] < re[kmin])) {
+		kmin++;
+	}
+
+	double psll = 0.0;
+	for (i = kmin; i <= nfft / 2; i++) {
+		if (re[i] > psll) {
+			psll = re[i];
+		}
+	}
+
+	double peak = re[0];
+	free(re);
+	free(im);
+
+	if ((peak <= 0.0) || (psll <= 0.0)) {
+		return -INFINITY;
+	}
+	return 10.0 * log10(psll / peak);
+}
+
+void win_metrics (
+		const double *win,
+		long long nsamples,
+		win_metrics_t *met
+	)
+{
+	double sum = 0.0;
+	double sum2 = 0.0;
+	double wmax = 0.0;
+	double hre = 0.0;
+	double him = 0.0;
+
+	long long i;
+	for (i = 0; i < nsamples; i++) {
+		sum += win[i];
+		sum2 += win[i] * win[i];
+		if (win[i] > wmax) {
+			wmax = win[i];
+		}
+		// Response at half bin offset //
+		hre += win[i] * cos(M_PI * i / nsamples);
+		him -= win[i] * sin(M_PI * i / nsamples);
+	}
+
+	met->psll = win_sidelobe(win, nsamples, WIN_FFT_PAD);
+	met->cgain = (wmax > 0.0) ? sum / nsamples / wmax : 0.0;
+	met->enbw = (sum != 0.0) ? nsamples * sum2 / (sum * sum) : 0.0;
+	met->scallop = (sum != 0.0) ? -20.0 * log10(sqrt(hre * hre + him * him) / fabs(sum)) : 0.0;
+}
+
+double sin_sfdr (
+		const double *sig,
+		long long nsamples
+	)
+{
+	double *re = (double *)malloc(nsamples * sizeof(double));
+	double *im = (double *)calloc(nsamples, sizeof(double));
+
+	long long i;
+	for (i = 0; i < nsamples; i++) {
+		re[i] = sig[i];
+	}
+	win_fft(re, im, nsamples);
+
+	// One period: carrier in bin 1, everything else is spur //
+	double carrier = re[1] * re[1] + im[1] * im[1];
+	double spur = 0.0;
+	for (i = 0; i <= nsamples / 2; i++) {
+		double pwr = re[i] * re[i] + im[i] * im[i];
+		if ((i != 1) && (pwr > spur)) {
+			spur = pwr;
+		}
+	}
+
+	free(re);
+	free(im);
+
+	if (spur <= 0.0) {
+		return INFINITY;
+	}
+	return 10.0 * log10(carrier / spur);
+}
+
+int win_verify (
+		const char *name,
+		const win_metrics_t *met,
+		double psll_max
+	)
+{
+	printf("%s: side-lobe level = %.2f dB (max %.2f dB), coherent gain = %.4f, ENBW = %.4f bins, scalloping loss = %.2f dB\n",
+		name, met->psll, psll_max, met->cgain, met->enbw, met->scallop);
+
+	if (met->psll <= psll_max) {
+		return 0;
+	}
+	printf("FAIL: %s side-lobe level is above threshold\n", name);
+	return 1;
+}
+
+int sin_verify (
+		const char *name,
+		double sfdr,
+		double sfdr_min
+	)
+{
+	printf("%s: SFDR = %.2f dBc (min %.2f dBc)\n", name, sfdr, sfdr_min);
+
+	if (sfdr >= sfdr_min) {
+		return 0;
+	}
+	printf("FAIL: %s SFDR is below threshold\n", name);
+	return 1;
+}
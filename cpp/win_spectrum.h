@@ -0,0 +1,96 @@
+/*******************************************************************************
+--
+-- Title       : win_spectrum.h
+-- Design      : Window functions: spectral analysis
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : FFT and side-lobe level of generated windows
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef WIN_SPECTRUM_H
+#define WIN_SPECTRUM_H
+
+/* ---- Zero-padding factor for side-lobe search --- */
+#define WIN_FFT_PAD 8
+
+/* ---- In-place radix-2 FFT, n must be a power of 2 --- */
+void win_fft (
+	double *re,
+	double *im,
+	long long n
+);
+
+/* ---- Peak side-lobe level (dB) relative to main lobe --- */
+double win_sidelobe (
+	const double *win,
+	long long nsamples,
+	int pad
+);
+
+/* ---- Window spectral metrics --- */
+typedef struct {
+	double psll;    // Peak side-lobe level, dB
+	double cgain;   // Coherent gain: sum(w) / N / max(w)
+	double enbw;    // Equivalent noise bandwidth, bins
+	double scallop; // Scalloping loss, dB
+} win_metrics_t;
+
+void win_metrics (
+	const double *win,
+	long long nsamples,
+	win_metrics_t *met
+);
+
+/* ---- Spurious-free dynamic range (dBc) of one-period sine --- */
+double sin_sfdr (
+	const double *sig,
+	long long nsamples
+);
+
+/* ---- Print metrics and check thresholds: 0 - pass, 1 - fail --- */
+int win_verify (
+	const char *name,
+	const win_metrics_t *met,
+	double psll_max
+);
+
+int sin_verify (
+	const char *name,
+	double sfdr,
+	double sfdr_min
+);
+
+#endif
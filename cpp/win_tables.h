@@ -0,0 +1,172 @@
+/*******************************************************************************
+--
+-- Title       : win_tables.h
+-- Design      : Shared CORDIC and window tables
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : One copy of constants of HLS win_function for host models: CORDIC look-up
+--               table, gain and PI/4 in 48-bit format, cosine-sum coefficients and scale
+--               shift of each window type, and the fixed-point CORDIC itself. Everything
+--               is constexpr, so cpp/win_model (run time) and cpp/win_rom.h (compile time)
+--               use the same code and a coefficient change cannot diverge between them.
+--               VHDL models (cpp/vhd_model, cpp/dsp48_model) use the look-up table, gain
+--               and win_wrap, keeping only their own 2*PI table and gain of PRECISION 1.
+--               hls/windows/win_function.cpp keeps its own copy for synthesis (ap_int).
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef WIN_TABLES_H
+#define WIN_TABLES_H
+
+#include "win_model.h"
+
+/* ---- Look-up table: ATAN(2^-i) * (2^48 / PI) --- */
+static constexpr long long WIN_LUT48 [48] = {
+	0x400000000000, 0x25C80A3B3BE6, 0x13F670B6BDC7, 0x0A2223A83BBB,
+	0x05161A861CB1, 0x028BAFC2B209, 0x0145EC3CB850, 0x00A2F8AA23A9,
+	0x00517CA68DA2, 0x0028BE5D7661, 0x00145F300123, 0x000A2F982950,
+	0x000517CC19C0, 0x00028BE60D83, 0x000145F306D6, 0x0000A2F9836D,
+	0x0000517CC1B7, 0x000028BE60DC, 0x0000145F306E, 0x00000A2F9837,
+	0x00000517CC1B, 0x0000028BE60E, 0x00000145F307, 0x000000A2F983,
+	0x000000517CC2, 0x00000028BE61, 0x000000145F30, 0x0000000A2F98,
+	0x0000000517CC, 0x000000028BE6, 0x0000000145F3, 0x00000000A2FA,
+	0x00000000517D, 0x0000000028BE, 0x00000000145F, 0x000000000A30,
+	0x000000000518, 0x00000000028C, 0x000000000146, 0x0000000000A3,
+	0x000000000051, 0x000000000029, 0x000000000014, 0x00000000000A,
+	0x000000000005, 0x000000000003, 0x000000000001, 0x000000000000
+};
+
+/* ---- Gain 1/K and PI/4 in 48-bit format --- */
+static constexpr long long WIN_GAIN48 = 0x26DD3B6A10D8;
+static constexpr long long WIN_QPI48 = 0xC90FDAA22169;
+
+/* ---- Coefficients and scale shift by window type (as in win_function.cpp) --- */
+static constexpr double WIN_COE [8][WIN_MAXTERM] = {
+	{ 0 },
+	{ 0.5434783, 1.0 - 0.5434783 },
+	{ 0.5, 0.5 },
+	{ 0.21, 0.25, 0.04 },
+	{ 0.35875, 0.48829, 0.14128, 0.01168 },
+	{ 0.3232153788877343, 0.4714921439576260, 0.1755341299601972,
+	  0.0284969901061499, 0.0012613570882927 },
+	{ 0 },
+	{ 0.271220360585039, 0.433444612327442, 0.218004122892930,
+	  0.065785343295606, 0.010761867305342, 0.000770012710581,
+	  0.000013680883060 },
+};
+
+static constexpr int WIN_NTERMS [8] = { 0, 2, 2, 3, 4, 5, 0, 7 };
+static constexpr int WIN_SHIFT [8] = { 1, 1, 1, 1, 1, 2, 1, 2 };
+
+/* ---- Wrap value to signed N-bit integer (ap_int<N> assignment) --- */
+constexpr long long win_wrap (
+		long long val,
+		int bits
+	)
+{
+	return (bits >= 64) ? val :
+		(long long)((unsigned long long)val << (64 - bits)) >> (64 - bits);
+}
+
+/* ---- Cosine and sine as calculated by HLS cordic() --- */
+typedef struct {
+	long long c;
+	long long s;
+} win_sc_t;
+
+constexpr win_sc_t win_cordic_sc (
+		int nphase,
+		int nwidth,
+		int nprec,
+		int niter,
+		long long phi
+	)
+{
+	// dat_t width //
+	const int dw = nwidth + nprec + 2;
+
+	long long phi_int = win_wrap(phi, nphase);
+
+	// Calculate quadrant and phase //
+	int quadrant = (int)((phi_int >> (nphase - 2)) & 0x3);
+
+	long long init_t = win_wrap(phi_int & (~(0x3LL << (nphase - 2))), dw);
+	long long init_z = 0;
+	if ((nphase-1) < nwidth) {
+		init_z = win_wrap((long long)((unsigned long long)init_t << (nwidth - nphase + 2 + nprec)), dw);
+	} else {
+		init_z = win_wrap((long long)((unsigned long long)(init_t >> (nphase - nwidth)) << (2 + nprec)), dw);
+	}
+
+	long long x = win_wrap(WIN_GAIN48 >> (48 - nwidth - nprec - 2), dw);
+	long long y = 0x0;
+	long long z = init_z;
+
+	for (int k = 0; k < niter; k++) {
+		long long lut_angle = win_wrap((WIN_LUT48[k] >> (48 - nwidth - nprec - 2 + 1)) & 0xFFFFFFFFFFLL, dw);
+		long long xk = x;
+
+		if (z < 0) {
+			x = win_wrap(x + (y >> k), dw);
+			y = win_wrap(y - (xk >> k), dw);
+			z = win_wrap(z + lut_angle, dw);
+		} else {
+			x = win_wrap(x - (y >> k), dw);
+			y = win_wrap(y + (xk >> k), dw);
+			z = win_wrap(z - lut_angle, dw);
+		}
+	}
+
+	// Reduced iterations: Taylor tail from residual angle //
+	if (niter < nwidth) {
+		__int128 qpi = WIN_QPI48 >> (48 - nwidth - nprec - 2);
+		__int128 z_rad = ((__int128)z * qpi) >> (nwidth + nprec);
+
+		long long xk = x;
+		x = win_wrap((long long)(x - (((__int128)y * z_rad) >> (nwidth + nprec + 1))), dw);
+		y = win_wrap((long long)(y + (((__int128)xk * z_rad) >> (nwidth + nprec + 1))), dw);
+	}
+
+	long long out_c = x >> (2 + nprec);
+	long long out_s = y >> (2 + nprec);
+
+	long long dat_c = (quadrant == 0x0) ? out_c : (quadrant == 0x1) ? -out_s : (quadrant == 0x2) ? -out_c : out_s;
+	long long dat_s = (quadrant == 0x0) ? out_s : (quadrant == 0x1) ? out_c : (quadrant == 0x2) ? -out_s : -out_c;
+
+	win_sc_t res = { win_wrap(win_wrap(dat_c, dw), nwidth), win_wrap(win_wrap(dat_s, dw), nwidth) };
+	return res;
+}
+
+#endif
@@ -0,0 +1,287 @@
+/*******************************************************************************
+--
+-- Title       : win_tuner.cpp
+-- Design      : Window functions: precision auto-tuner
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Find the cheapest (NWIDTH, NPREC, NITER) configuration which gives
+--               the target side-lobe level for selected window and length. Candidates
+--               are checked in parallel in order of increasing hardware cost.
+--               
+--               Usage: win_tuner <window> <log2 N> <target dB> [-t threads] [-o config.h]
+--               Example: win_tuner Blackman-Harris-4 12 -90 -o win_config.h
+--               
+--               Generated header overrides win_function.h constants:
+--                   -include win_config.h
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "win_model.h"
+#include "win_spectrum.h"
+
+/* ---- Search limits --- */
+#define TUNE_WMIN 6
+#define TUNE_WMAX 40
+#define TUNE_PMAX 3
+
+/* ---- One DSP48 counts as this number of LUT adder bits --- */
+#define DSP_COST 64
+
+typedef struct {
+	win_cfg_t cfg;
+	long long cost;
+	double psll;
+} tune_t;
+
+/* ---- Number of DSP48 slices for AxB signed multiplier (25x18) --- */
+static int dsp_count (
+		int a,
+		int b
+	)
+{
+	if (a < b) {
+		int t = a; a = b; b = t;
+	}
+	return ((a + 23) / 24) * ((b + 16) / 17);
+}
+
+/* ---- Hardware cost estimate: CORDIC adders, Taylor tail and weights --- */
+static long long win_cost (
+		const win_cfg_t *cfg,
+		int nterm
+	)
+{
+	int dw = cfg->nwidth + cfg->nprec + 2;
+
+	long long luts = 3LL * cfg->niter * dw;
+	long long dsps = dsp_count(cfg->nwidth, cfg->nwidth);
+
+	if (cfg->niter < cfg->nwidth) {
+		dsps += 3 * dsp_count(dw, dw);
+	}
+
+	return (nterm - 1) * (luts + DSP_COST * dsps);
+}
+
+static int tune_cmp (
+		const void *a,
+		const void *b
+	)
+{
+	const tune_t *ta = (const tune_t *)a;
+	const tune_t *tb = (const tune_t *)b;
+	if (ta->cost != tb->cost) {
+		return (ta->cost < tb->cost) ? -1 : 1;
+	}
+	return ta->cfg.nwidth - tb->cfg.nwidth;
+}
+
+/* ---- Side-lobe level of window generated by the bit-exact model --- */
+static double tune_eval (
+		const win_cfg_t *cfg,
+		int win_type,
+		double *win
+	)
+{
+	long long n = 1LL << cfg->nphase;
+	long long i;
+	for (i = 0; i < n; i++) {
+		win[i] = (double)win_model(cfg, win_type, i);
+	}
+	return win_sidelobe(win, n, WIN_FFT_PAD);
+}
+
+int main (int argc, char **argv) {
+
+	if (argc < 4) {
+		printf("Usage: %s <window> <log2 N> <target dB> [-t threads] [-o config.h]\n", argv[0]);
+		return 1;
+	}
+
+	int win_type = win_select(argv[1]);
+	int nphase = atoi(argv[2]);
+	double target = atof(argv[3]);
+
+	int nthreads = std::thread::hardware_concurrency();
+	const char *fname = NULL;
+
+	int i;
+	for (i = 4; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-t") == 0) {
+			nthreads = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-o") == 0) {
+			fname = argv[i+1];
+		}
+	}
+	if (nthreads < 1) {
+		nthreads = 1;
+	}
+
+	double coe[WIN_MAXTERM];
+	int shift;
+	int nterm = win_coeffs(win_type, coe, &shift);
+	if ((nterm == 0) || (nphase < 4) || (nphase > 24)) {
+		printf("FAIL: unknown window %s or wrong length 2^%d\n", argv[1], nphase);
+		return 1;
+	}
+
+	long long nsamples = 1LL << nphase;
+
+	// Side-lobe level of ideal window: nothing can be better //
+	double *win = (double *)malloc(nsamples * sizeof(double));
+	for (i = 0; i < nsamples; i++) {
+		win[i] = win_golden(win_type, i, nsamples);
+	}
+	double ideal = win_sidelobe(win, nsamples, WIN_FFT_PAD);
+	free(win);
+
+	printf("Window %s, N = 2^%d, ideal side-lobe level = %.2f dB, target = %.2f dB\n", 
+		win_name(win_type), nphase, ideal, target);
+
+	if (target < ideal) {
+		printf("FAIL: target is below side-lobe level of ideal window\n");
+		return 1;
+	}
+
+	// 6 dB per bit with processing gain of N samples //
+	int wmin = (int)floor((-target - 10.0 * log10((double)nsamples)) / 6.02);
+	if (wmin < TUNE_WMIN) {
+		wmin = TUNE_WMIN;
+	}
+
+	// Make sorted list of candidates //
+	int ncand = 0;
+	tune_t *cand = (tune_t *)malloc((TUNE_WMAX + 1) * (TUNE_PMAX + 1) * (TUNE_WMAX + 1) * sizeof(tune_t));
+
+	int w, p, k;
+	for (w = wmin; w <= TUNE_WMAX; w++) {
+		for (p = 0; (p <= TUNE_PMAX) && (w + p <= TUNE_WMAX); p++) {
+			for (k = w / 2; k <= w; k++) {
+				tune_t *t = &cand[ncand++];
+				t->cfg.nphase = nphase;
+				t->cfg.nwidth = w;
+				t->cfg.nprec = p;
+				t->cfg.niter = k;
+				t->cost = win_cost(&t->cfg, nterm);
+				t->psll = 0.0;
+			}
+		}
+	}
+	qsort(cand, ncand, sizeof(tune_t), tune_cmp);
+
+	// Check candidates in parallel, skip all which cost more than the best //
+	std::atomic<int> next(0);
+	std::atomic<int> nchecked(0);
+	std::mutex lock;
+	int best = -1;
+	long long best_cost = 0x7FFFFFFFFFFFFFFFLL;
+
+	std::thread *pool = new std::thread[nthreads];
+	for (i = 0; i < nthreads; i++) {
+		pool[i] = std::thread([&]() {
+			double *buf = (double *)malloc(nsamples * sizeof(double));
+			for (;;) {
+				int idx = next++;
+				if (idx >= ncand) {
+					break;
+				}
+				{
+					std::lock_guard<std::mutex> guard(lock);
+					if (cand[idx].cost >= best_cost) {
+						break;
+					}
+				}
+				cand[idx].psll = tune_eval(&cand[idx].cfg, win_type, buf);
+				nchecked++;
+
+				if (cand[idx].psll <= target) {
+					std::lock_guard<std::mutex> guard(lock);
+					if ((cand[idx].cost < best_cost) || ((cand[idx].cost == best_cost) && (idx < best))) {
+						best_cost = cand[idx].cost;
+						best = idx;
+					}
+				}
+			}
+			free(buf);
+		});
+	}
+	for (i = 0; i < nthreads; i++) {
+		pool[i].join();
+	}
+	delete[] pool;
+
+	printf("Checked %d of %d configurations on %d threads\n", (int)nchecked, ncand, nthreads);
+
+	if (best < 0) {
+		printf("FAIL: no configuration up to NWIDTH = %d meets the target\n", TUNE_WMAX);
+		free(cand);
+		return 1;
+	}
+
+	win_cfg_t *cfg = &cand[best].cfg;
+	printf("NPHASE = %d, NWIDTH = %d, NPREC = %d, NITER = %d: side-lobe level = %.2f dB, cost = %lld\n",
+		cfg->nphase, cfg->nwidth, cfg->nprec, cfg->niter, cand[best].psll, cand[best].cost);
+
+	if (fname) {
+		FILE *fcfg = fopen(fname, "w");
+		if (!fcfg) {
+			printf("FAIL: cannot open %s\n", fname);
+			free(cand);
+			return 1;
+		}
+		fprintf(fcfg, "/* ---- win_tuner: %s, N = 2^%d, side-lobe level %.2f dB (target %.2f dB) --- */\n",
+			win_name(win_type), nphase, cand[best].psll, target);
+		fprintf(fcfg, "#define Wintype \"%s\"\n", win_name(win_type));
+		fprintf(fcfg, "#define NPHASE %d\n", cfg->nphase);
+		fprintf(fcfg, "#define NWIDTH %d\n", cfg->nwidth);
+		fprintf(fcfg, "#define NPREC %d\n", cfg->nprec);
+		fprintf(fcfg, "#define NITER %d\n", cfg->niter);
+		fprintf(fcfg, "\n/* ---- VHDL: PHI_WIDTH => %d, DAT_WIDTH => %d --- */\n", cfg->nphase, cfg->nwidth);
+		fclose(fcfg);
+		printf("Configuration is written to %s\n", fname);
+	}
+
+	free(cand);
+	return 0;
+}
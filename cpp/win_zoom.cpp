@@ -0,0 +1,244 @@
+/*******************************************************************************
+--
+-- Title       : win_zoom.cpp
+-- Design      : Partial access to huge window through lazy tiled view
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Concurrent readers take zoomed views (random regions), decimated frames
+--               (every d-th sample of a region) and sequential scan of a part of window
+--               through lazy view (cpp/win_lazy). Samples are checked against win_model,
+--               result is JSON: generated tiles, hits, waits, prefetch, eviction and time
+--               versus full window generation.
+--               
+--               Usage: win_zoom <window> <NPHASE> <NWIDTH> [-b tile bits] [-m budget MB]
+--                               [-t threads] [-z views per thread]
+--               Example: win_zoom Blackman-Harris-4 26 24 -m 64
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "win_lazy.h"
+
+/* ---- View length, decimation and scan part (1/ZOOM_SCAN of window) --- */
+#define ZOOM_VIEW  4096
+#define ZOOM_DECIM 16
+#define ZOOM_SCAN  64
+
+/* ---- Every ZOOM_CHECK-th sample is compared with the model --- */
+#define ZOOM_CHECK 61
+
+static double time_ns (
+		std::chrono::steady_clock::time_point start
+	)
+{
+	auto stop = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+/* ---- xorshift64: reproducible view positions for each thread --- */
+static unsigned long long next_rand (
+		unsigned long long *seed
+	)
+{
+	unsigned long long x = *seed;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	*seed = x;
+	return x;
+}
+
+static long long check_view (
+		win_lazy_t *lazy,
+		long long start,
+		long long step,
+		long long count,
+		const long long *out
+	)
+{
+	long long errors = 0;
+	long long j;
+	for (j = 0; j < count; j += ZOOM_CHECK) {
+		long long i = (start + j * step) & (lazy->nsamples - 1);
+		errors += (out[j] != win_model(&lazy->cfg, lazy->win_type, i));
+	}
+	return errors;
+}
+
+int main (int argc, char **argv) {
+
+	if (argc < 4) {
+		printf("Usage: %s <window> <NPHASE> <NWIDTH> [-b tile bits] [-m budget MB] [-t threads] [-z views]\n", argv[0]);
+		return 1;
+	}
+
+	win_cfg_t cfg;
+	int win_type = win_select(argv[1]);
+	cfg.nphase = atoi(argv[2]);
+	cfg.nwidth = atoi(argv[3]);
+	cfg.nprec = 0;
+	cfg.niter = cfg.nwidth;
+
+	int tile_bits = LAZY_TILE_BITS;
+	long long budget = 0;
+	int nthreads = 4;
+	int nviews = 8;
+
+	int i;
+	for (i = 4; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-b") == 0) {
+			tile_bits = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-m") == 0) {
+			budget = atoll(argv[i+1]) << 20;
+		} else if (strcmp(argv[i], "-t") == 0) {
+			nthreads = atoi(argv[i+1]);
+		} else if (strcmp(argv[i], "-z") == 0) {
+			nviews = atoi(argv[i+1]);
+		}
+	}
+	if ((win_type == WIN_EMPTY) || (cfg.nphase < 12) || (cfg.nphase > 34) || (cfg.nwidth < 8) || (cfg.nwidth > 32) || (nthreads < 1)) {
+		printf("FAIL: unknown window %s, wrong widths or threads\n", argv[1]);
+		return 1;
+	}
+
+	win_lazy_t *lazy = new win_lazy_t;
+	if (win_lazy_init(lazy, &cfg, win_type, tile_bits, budget)) {
+		printf("FAIL: wrong tile size\n");
+		delete lazy;
+		return 1;
+	}
+
+	std::atomic<long long> errors(0);
+	std::atomic<long long> samples(0);
+	std::atomic<int> nomem(0);
+	std::thread *pool = new std::thread[nthreads];
+
+	auto start = std::chrono::steady_clock::now();
+	for (i = 0; i < nthreads; i++) {
+		pool[i] = std::thread([&, i]() {
+			unsigned long long seed = 0x9E3779B97F4A7C15ULL * (i + 1);
+			long long *buf = (long long *)malloc(ZOOM_VIEW * sizeof(long long));
+			long long err = 0, cnt = 0;
+			int v;
+			for (v = 0; v < nviews; v++) {
+				// Zoomed view //
+				long long pos = next_rand(&seed) & (lazy->nsamples - 1);
+				if (win_lazy_read(lazy, pos, ZOOM_VIEW, buf)) {
+					nomem = 1;
+					break;
+				}
+				err += check_view(lazy, pos, 1, ZOOM_VIEW, buf);
+
+				// Decimated frame //
+				pos = next_rand(&seed) & (lazy->nsamples - 1);
+				if (win_lazy_stride(lazy, pos, ZOOM_DECIM, ZOOM_VIEW, buf)) {
+					nomem = 1;
+					break;
+				}
+				err += check_view(lazy, pos, ZOOM_DECIM, ZOOM_VIEW, buf);
+				cnt += 2 * ZOOM_VIEW;
+			}
+
+			// Sequential scan of one part (prefetch ahead) //
+			long long part = lazy->nsamples / ZOOM_SCAN;
+			long long pos = (long long)(next_rand(&seed) % ZOOM_SCAN) * part;
+			win_lazy_prefetch(lazy, pos, ZOOM_VIEW);
+			long long off;
+			for (off = 0; (off < part) && !nomem; off += ZOOM_VIEW) {
+				if (win_lazy_read(lazy, pos + off, ZOOM_VIEW, buf)) {
+					nomem = 1;
+					break;
+				}
+				err += check_view(lazy, pos + off, 1, ZOOM_VIEW, buf);
+				cnt += ZOOM_VIEW;
+			}
+			free(buf);
+			errors += err;
+			samples += cnt;
+		});
+	}
+	for (i = 0; i < nthreads; i++) {
+		pool[i].join();
+	}
+	double lazy_ns = time_ns(start);
+	delete[] pool;
+
+	// Full window estimate: time of one tile //
+	const long long tsize = 1LL << lazy->tile_bits;
+	long long *tile = (long long *)malloc(tsize * sizeof(long long));
+	start = std::chrono::steady_clock::now();
+	win_model_block(&cfg, win_type, 0, tsize, tile);
+	double full_ns = time_ns(start) * lazy->ntiles;
+	free(tile);
+
+	lazy_stats_t st;
+	win_lazy_stats(lazy, &st);
+	const long long generated = st.builds;
+
+	printf("{\n  \"window\": \"%s\", \"nphase\": %d, \"nwidth\": %d, \"tile\": %lld, \"tiles\": %lld,\n",
+		win_name(win_type), cfg.nphase, cfg.nwidth, tsize, st.ntiles);
+	printf("  \"threads\": %d, \"samples_read\": %lld, \"budget_tiles\": %lld,\n", nthreads, samples.load(), lazy->budget);
+	printf("  \"generated\": %lld, \"generated_part\": %.4f, \"resident\": %lld, \"peak\": %lld,\n",
+		generated, (double)generated / st.ntiles, st.resident, st.peak);
+	printf("  \"hits\": %lld, \"misses\": %lld, \"waits\": %lld, \"prefetched\": %lld, \"evicted\": %lld, \"alloc_fails\": %lld,\n",
+		st.hits, st.misses, st.waits, st.prefetched, st.evicted, st.fails);
+	printf("  \"lazy_ms\": %.1f, \"full_ms\": %.1f, \"errors\": %lld\n}\n", lazy_ns * 1e-6, full_ns * 1e-6, errors.load());
+
+	const long long budget_tiles = lazy->budget;
+	win_lazy_free(lazy);
+	delete lazy;
+
+	if (nomem) {
+		printf("FAIL: cannot allocate tile memory\n");
+		return 1;
+	}
+	if (errors) {
+		printf("FAIL: %lld samples differ from the model\n", errors.load());
+		return 1;
+	}
+	if (budget_tiles && (st.peak > budget_tiles + nthreads + 1)) {
+		printf("FAIL: %lld tiles in memory, budget %lld\n", st.peak, budget_tiles);
+		return 1;
+	}
+	printf("PASS: lazy view matches the model\n");
+	return 0;
+}
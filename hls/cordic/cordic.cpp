@@ -42,6 +42,79 @@
 #include <math.h>
 #include "cordic.h"
 
+/* ---- Look-up table: ATAN(2^-i) * (2^48 / PI) --- */
+static const long long lut_table [48] = {
+	0x400000000000, 0x25C80A3B3BE6, 0x13F670B6BDC7, 0x0A2223A83BBB,
+	0x05161A861CB1, 0x028BAFC2B209, 0x0145EC3CB850, 0x00A2F8AA23A9,
+	0x00517CA68DA2, 0x0028BE5D7661, 0x00145F300123, 0x000A2F982950,
+	0x000517CC19C0, 0x00028BE60D83, 0x000145F306D6, 0x0000A2F9836D,
+	0x0000517CC1B7, 0x000028BE60DC, 0x0000145F306E, 0x00000A2F9837,
+	0x00000517CC1B, 0x0000028BE60E, 0x00000145F307, 0x000000A2F983,
+	0x000000517CC2, 0x00000028BE61, 0x000000145F30, 0x0000000A2F98,
+	0x0000000517CC, 0x000000028BE6, 0x0000000145F3, 0x00000000A2FA,
+	0x00000000517D, 0x0000000028BE, 0x00000000145F, 0x000000000A30,
+	0x000000000518, 0x00000000028C, 0x000000000146, 0x0000000000A3,
+	0x000000000051, 0x000000000029, 0x000000000014, 0x00000000000A,
+	0x000000000005, 0x000000000003, 0x000000000001, 0x000000000000
+};
+
+/* ---- Quadrant and initial angle from input phase --- */
+static void cordic_phase (
+		phi_t phi_int,
+		dbl_t *quadrant,
+		dat_t *init_z
+	)
+{
+	#pragma HLS INLINE
+
+	*quadrant = phi_int >> (NPHASE - 2);
+
+	dat_t init_t =  phi_int & (~(0x3 << (NPHASE - 2)));
+	
+	if ((NPHASE-1) < NWIDTH) {
+		*init_z = init_t << (NWIDTH - NPHASE + 2);
+	}
+	else {
+		*init_z = (init_t >> (NPHASE - NWIDTH)) << 2;
+	}	
+}
+
+/* ---- Output sign of data by quadrant --- */
+static void cordic_quadrant (
+		dbl_t quadrant,
+		dat_t out_c,
+		dat_t out_s,
+		out_t *out_cos,
+		out_t *out_sin
+	)
+{
+	#pragma HLS INLINE
+
+	dat_t dat_c;
+	dat_t dat_s;
+
+	if (quadrant == 0x0) {
+		dat_s = out_s;
+		dat_c = out_c;
+	}
+	else if (quadrant == 0x1) {
+		dat_s = out_c;
+		dat_c = ~(out_s) + 1;
+	}
+	else if (quadrant == 0x2) {
+		dat_s = ~(out_s) + 1;
+		dat_c = ~(out_c) + 1;
+	}
+	else {
+		dat_s = ~(out_c) + 1;
+		dat_c = out_s;
+	}
+	
+	// Get output values //
+	*out_cos = (dat_c);
+	*out_sin = (dat_s);
+}
+
 void cordic (
 		phi_t phi_int,
 		out_t *out_cos,
@@ -53,22 +126,6 @@ void cordic (
 	#pragma HLS INTERFACE register port=out_sin
 	#pragma HLS PIPELINE
 
-	// Create Look-up table array //
-	long long lut_table [48] = {
-		0x400000000000, 0x25C80A3B3BE6, 0x13F670B6BDC7, 0x0A2223A83BBB,
-		0x05161A861CB1, 0x028BAFC2B209, 0x0145EC3CB850, 0x00A2F8AA23A9,
-		0x00517CA68DA2, 0x0028BE5D7661, 0x00145F300123, 0x000A2F982950,
-		0x000517CC19C0, 0x00028BE60D83, 0x000145F306D6, 0x0000A2F9836D,
-		0x0000517CC1B7, 0x000028BE60DC, 0x0000145F306E, 0x00000A2F9837,
-		0x00000517CC1B, 0x0000028BE60E, 0x00000145F307, 0x000000A2F983,
-		0x000000517CC2, 0x00000028BE61, 0x000000145F30, 0x0000000A2F98,
-		0x0000000517CC, 0x000000028BE6, 0x0000000145F3, 0x00000000A2FA,
-		0x00000000517D, 0x0000000028BE, 0x00000000145F, 0x000000000A30,
-		0x000000000518, 0x00000000028C, 0x000000000146, 0x0000000000A3,
-		0x000000000051, 0x000000000029, 0x000000000014, 0x00000000000A,
-		0x000000000005, 0x000000000003, 0x000000000001, 0x000000000000
-	};
-
 	static dat_t lut_angle[NWIDTH - 1];
 
 	int i;
@@ -81,17 +138,9 @@ void cordic (
 	static const dat_t GAIN48 = (0x26DD3B6A10D8 >> (48 - NWIDTH - 2));
 
 	// Calculate quadrant and phase //
-	dbl_t quadrant = phi_int >> (NPHASE - 2);
-
-	dat_t init_t =  phi_int & (~(0x3 << (NPHASE - 2)));
-	
+	dbl_t quadrant;
 	dat_t init_z;
-	if ((NPHASE-1) < NWIDTH) {
-		init_z = init_t << (NWIDTH - NPHASE + 2);
-	}
-	else {
-		init_z = (init_t >> (NPHASE - NWIDTH)) << 2;
-	}	
+	cordic_phase(phi_int, &quadrant, &init_z);
 
 	// Create array for parallel calculation //
 	dat_t x[NWIDTH + 1];
@@ -126,29 +175,79 @@ void cordic (
 	dat_t out_c = (x[NWIDTH] >> 2);
 	dat_t out_s = (y[NWIDTH] >> 2);
 
-	dat_t dat_c;
-	dat_t dat_s;
-
 	// Check quadrant and find output sign of data //
-	if (quadrant == 0x0) {
-		dat_s = out_s;
-		dat_c = out_c;
-	}
-	else if (quadrant == 0x1) {
-		dat_s = out_c;
-		dat_c = ~(out_s) + 1;
-	}
-	else if (quadrant == 0x2) {
-		dat_s = ~(out_s) + 1;
-		dat_c = ~(out_c) + 1;
-	}
-	else {
-		dat_s = ~(out_c) + 1;
-		dat_c = out_s;
-	}
+	cordic_quadrant(quadrant, out_c, out_s, out_cos, out_sin);
+
+}
+
+void cordic_hybrid (
+		phi_t phi_int,
+		out_t *out_cos,
+		out_t *out_sin
+	)
+{
+	#pragma HLS INTERFACE port=phi_int
+	#pragma HLS INTERFACE register port=out_cos
+	#pragma HLS INTERFACE register port=out_sin
+	#pragma HLS PIPELINE
+
+	static dat_t lut_angle[NITER];
+
+	int i;
+	for (i = 0; i < NITER; i++) {
+		lut_angle[i] = (lut_table[i] >> (48 - NWIDTH - 2 + 1) & 0xFFFFFFFFFF);
+	}	
+
+	// Set data output gain level and PI/4 for residual angle //
+	static const dat_t GAIN48 = (0x26DD3B6A10D8 >> (48 - NWIDTH - 2));
+	static const prd_t QPI48 = (0xC90FDAA22169 >> (48 - NWIDTH - 2));
+
+	// Calculate quadrant and phase //
+	dbl_t quadrant;
+	dat_t init_z;
+	cordic_phase(phi_int, &quadrant, &init_z);
+
+	// Create array for parallel calculation //
+	dat_t x[NITER + 1];
+	dat_t y[NITER + 1];
+	dat_t z[NITER + 1];	
 	
-	// Get output values //
-	*out_cos = (dat_c);
-	*out_sin = (dat_s);
+	// Initial values //
+	x[0] = GAIN48;
+	y[0] = 0x0;
+	z[0] = init_z;	
+
+	// Unrolled loop: first NITER stages only //
+	int k;
+	stg: for (k = 0; k < NITER; k++) {
+	#pragma HLS UNROLL
+
+		if (z[k] < 0) {
+			x[k+1] = x[k] + (y[k] >> k);
+			y[k+1] = y[k] - (x[k] >> k);
+
+			z[k+1] = z[k] + lut_angle[k];
+		} else {						
+			x[k+1] = x[k] - (y[k] >> k);
+			y[k+1] = y[k] + (x[k] >> k);
+
+			z[k+1] = z[k] - lut_angle[k];
+		}
+
+	} 	
+
+	// Residual angle in radians: z * PI / 2^(NWIDTH+1) //
+	prd_t z_rad = (z[NITER] * QPI48) >> NWIDTH;
+
+	// Taylor tail: cos(z) ~ 1, sin(z) ~ z //
+	dat_t x_tay = x[NITER] - ((y[NITER] * z_rad) >> (NWIDTH + 1));
+	dat_t y_tay = y[NITER] + ((x[NITER] * z_rad) >> (NWIDTH + 1));
+
+	// Shift output data by 2 //
+	dat_t out_c = (x_tay >> 2);
+	dat_t out_s = (y_tay >> 2);
+
+	// Check quadrant and find output sign of data //
+	cordic_quadrant(quadrant, out_c, out_s, out_cos, out_sin);
 
 }
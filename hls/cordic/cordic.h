@@ -44,8 +44,17 @@
 #include "ap_int.h"
 
 /* ---- Constants  --- */
+#ifndef NPHASE
 #define NPHASE 10
+#endif
+#ifndef NWIDTH
 #define NWIDTH 16
+#endif
+
+/* ---- Hybrid CORDIC: rotations before Taylor tail --- */
+#ifndef NITER
+#define NITER (NWIDTH/2 + 2)
+#endif
 
 /* ---- Data types --- */
 typedef ap_uint<2> dbl_t;
@@ -53,6 +62,7 @@ typedef ap_uint<2> dbl_t;
 typedef ap_int<NPHASE> phi_t;
 typedef ap_int<NWIDTH+2> dat_t;
 typedef ap_int<NWIDTH> out_t;
+typedef ap_int<2*NWIDTH+4> prd_t;
 
 /* ---- Top level function --- */
 void cordic (
@@ -61,3 +71,10 @@ void cordic (
 	out_t *out_sin
     );
 
+/* ---- Reduced-iteration CORDIC with first-order correction --- */
+void cordic_hybrid (
+	phi_t phi_int,
+	out_t *out_cos,
+	out_t *out_sin
+    );
+
@@ -41,8 +41,13 @@
 -- 
 *******************************************************************************/
 #include <stdio.h>
+#include <stdlib.h>
 #include <math.h>
 #include "cordic.h"
+#include "../../cpp/win_spectrum.h"
+
+/* ---- Minimal SFDR: 6 dB per bit of sine magnitude --- */
+#define SFDR_MIN (6.0 * (NWIDTH - 2))
 
 int main () {
 
@@ -50,47 +55,81 @@ int main () {
 
 	out_t s, c;
 	out_t ts, tc;
+	out_t hs, hc;
 
 	printf("Phase = %d, Data = %d, Result: \n", NPHASE, NWIDTH);
 
-	int acc_s = 0x0;
-	int acc_c = 0x0;
+	double acc_s = 0.0;
+	double acc_c = 0.0;
+	double acc_hs = 0.0;
+	double acc_hc = 0.0;
 	
 	//int res = out_t.length;
 
+	double *dat_s = (double *)malloc(NSAMPLES * sizeof(double));
+	double *dat_c = (double *)malloc(NSAMPLES * sizeof(double));
+	double *dat_h = (double *)malloc(NSAMPLES * sizeof(double));
+
+#ifdef DUMP_DATA
+	/* Text output for math/cordic_test.m */
 	FILE *fout;	
 	FILE *fgld;	
 	fout = fopen("..\\..\\..\\..\\math\\dout.dat", "w");	
 	fgld = fopen("..\\..\\..\\..\\math\\golden_dat.dat", "w");	
+#endif
 	
 	int i = 0x0;
 	for (i = 0; i < NSAMPLES; i++)
 	{
 		cordic(i, &c, &s);
+		cordic_hybrid(i, &hc, &hs);
 		ts = round( (pow(2.0, NWIDTH-2)) * sin((2 * i * M_PI) / NSAMPLES) );
 		tc = round( (pow(2.0, NWIDTH-2)) * cos((2 * i * M_PI) / NSAMPLES) );
 		
 		acc_s += sqrt(pow(abs(s - ts), 2));
 		acc_c += sqrt(pow(abs(c - tc), 2));
+		acc_hs += sqrt(pow(abs(hs - ts), 2));
+		acc_hc += sqrt(pow(abs(hc - tc), 2));
+
+		dat_s[i] = (double)s;
+		dat_c[i] = (double)c;
+		dat_h[i] = (double)hs;
 
-		fprintf(fout, "%d \t %d \n", s, c);
-		fprintf(fgld, "%d \t %d \n", ts, tc);
+#ifdef DUMP_DATA
+		fprintf(fout, "%d \t %d \n", (int)s, (int)c);
+		fprintf(fgld, "%d \t %d \n", (int)ts, (int)tc);
+#endif
 		
 		if ((i > NSAMPLES/2 - 8) &&  (i < NSAMPLES/2 + 8))
 		{
-			printf("%08X %08X \t %08X %08X, \t Err s/c = %d %d\n", s, ts, c, tc, acc_s, acc_c);
+			printf("%08X %08X \t %08X %08X, \t Err s/c = %.0f %.0f\n", s, ts, c, tc, acc_s, acc_c);
 		}
 		
 	}
 	acc_s /= NSAMPLES;
 	acc_c /= NSAMPLES;
+	acc_hs /= NSAMPLES;
+	acc_hc /= NSAMPLES;
 	
+#ifdef DUMP_DATA
 	fclose(fout);
-	fclose(fout);
+	fclose(fgld);
+#endif
 	
-	printf("\n Err_sin = %d, Err_cos = %d \n", acc_s, acc_c);
+	printf("\n Err_sin = %.4f, Err_cos = %.4f \n", acc_s, acc_c);
+	printf(" Hybrid (%d iterations): Err_sin = %.4f, Err_cos = %.4f \n\n", NITER, acc_hs, acc_hc);
+
+	/* Spectral check instead of math/cordic_test.m */
+	int err_spec = 0;
+	err_spec += sin_verify("Sine", sin_sfdr(dat_s, NSAMPLES), SFDR_MIN);
+	err_spec += sin_verify("Cosine", sin_sfdr(dat_c, NSAMPLES), SFDR_MIN);
+	err_spec += sin_verify("Hybrid sine", sin_sfdr(dat_h, NSAMPLES), SFDR_MIN);
+
+	free(dat_s);
+	free(dat_c);
+	free(dat_h);
 
-	if ((acc_s < 10) && (acc_c < 10)) {
+	if ((acc_s < 10) && (acc_c < 10) && (acc_hs < 10) && (acc_hc < 10) && (err_spec == 0)) {
 		printf ("PASS: Data matches the golden output!\n");
 		return 0;
 	} else {
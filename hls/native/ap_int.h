@@ -0,0 +1,164 @@
+/*******************************************************************************
+--
+-- Title       : ap_int.h
+-- Design      : Native arbitrary precision integers
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Lightweight replacement of vendor ap_int.h for C simulation on plain
+--               Linux host. Only API subset of HLS sources is supported: construction,
+--               shifts, arithmetic, comparison and casts, widths from 1 to 128 bits.
+--               
+--               Data is stored in int32_t / int64_t / __int128 and wrapped (two's
+--               complement) to W bits on every assignment, as ap_int<W> does. Expressions
+--               are calculated in the next wider type, so intermediate results do not
+--               overflow: ap_int<A> * ap_int<B> is exact for A + B <= 128. Types wider
+--               than 64 bits are calculated in __int128 too (ap_uint up to 127 bits).
+--               Shift left and bitwise NOT keep operand width as in ap_int.
+--               
+--               Use this directory as include path for native build only:
+--                   g++ -O2 -I../native win_function.cpp window_test.cpp ...
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef AP_INT_NATIVE_H
+#define AP_INT_NATIVE_H
+
+#include <stdint.h>
+
+/* ---- Storage and expression types by number of bits --- */
+template<int B> struct ap_native_type {
+	typedef __int128 store_t;
+	typedef __int128 op_t;
+	typedef unsigned __int128 uop_t;
+};
+
+template<> struct ap_native_type<32> {
+	typedef int32_t store_t;
+	typedef int64_t op_t;
+	typedef uint64_t uop_t;
+};
+
+template<> struct ap_native_type<64> {
+	typedef int64_t store_t;
+	typedef __int128 op_t;
+	typedef unsigned __int128 uop_t;
+};
+
+/* ---- Signed storage of W bits (one more bit for unsigned) --- */
+#define AP_NATIVE_BITS(W, S) (((W) + ((S) ? 0 : 1) <= 32) ? 32 : ((W) + ((S) ? 0 : 1) <= 64) ? 64 : 128)
+
+template<int W, bool S> class ap_native {
+	static_assert((W >= 1) && (W <= (S ? 128 : 127)), "ap_native: width must be from 1 to 128 bits (127 for unsigned)");
+
+public:
+	typedef ap_native_type<AP_NATIVE_BITS(W, S)> type_t;
+	typedef typename type_t::store_t store_t;
+	typedef typename type_t::op_t op_t;
+	typedef typename type_t::uop_t uop_t;
+
+private:
+	store_t v;
+
+	/* ---- Two's complement wrap to W bits --- */
+	static store_t wrap(op_t val) {
+		const int sh = (int)(8 * sizeof(op_t)) - W;
+		if (S) {
+			return (store_t)((op_t)((uop_t)val << sh) >> sh);
+		}
+		return (store_t)((uop_t)val & (~(uop_t)0 >> sh));
+	}
+
+public:
+	/* ---- Construction: value is wrapped to W bits --- */
+	ap_native() : v(0) {}
+	ap_native(bool x) : v(wrap((op_t)x)) {}
+	ap_native(char x) : v(wrap((op_t)x)) {}
+	ap_native(signed char x) : v(wrap((op_t)x)) {}
+	ap_native(unsigned char x) : v(wrap((op_t)x)) {}
+	ap_native(short x) : v(wrap((op_t)x)) {}
+	ap_native(unsigned short x) : v(wrap((op_t)x)) {}
+	ap_native(int x) : v(wrap((op_t)x)) {}
+	ap_native(unsigned int x) : v(wrap((op_t)x)) {}
+	ap_native(long x) : v(wrap((op_t)x)) {}
+	ap_native(unsigned long x) : v(wrap((op_t)x)) {}
+	ap_native(long long x) : v(wrap((op_t)x)) {}
+	ap_native(unsigned long long x) : v(wrap((op_t)x)) {}
+	ap_native(__int128 x) : v(wrap((op_t)x)) {}
+	ap_native(unsigned __int128 x) : v(wrap((op_t)x)) {}
+	ap_native(float x) : v(wrap((op_t)(__int128)x)) {}
+	ap_native(double x) : v(wrap((op_t)(__int128)x)) {}
+
+	template<int W2, bool S2> ap_native(const ap_native<W2, S2> &x) : v(wrap((op_t)x.raw())) {}
+
+	/* ---- Value in wider type: all arithmetic and comparison --- */
+	operator op_t() const { return v; }
+	store_t raw() const { return v; }
+
+	/* ---- Operators which keep operand width --- */
+	ap_native operator<<(int sh) const { return ap_native((op_t)((uop_t)v << sh)); }
+	ap_native operator>>(int sh) const { return ap_native((op_t)((op_t)v >> sh)); }
+	ap_native operator~() const { return ap_native((op_t)~(op_t)v); }
+
+	/* ---- Assignment operators --- */
+	template<typename T> ap_native &operator+=(const T &x) { *this = ap_native(*this + x); return *this; }
+	template<typename T> ap_native &operator-=(const T &x) { *this = ap_native(*this - x); return *this; }
+	template<typename T> ap_native &operator*=(const T &x) { *this = ap_native(*this * x); return *this; }
+	template<typename T> ap_native &operator/=(const T &x) { *this = ap_native(*this / x); return *this; }
+	template<typename T> ap_native &operator%=(const T &x) { *this = ap_native(*this % x); return *this; }
+	template<typename T> ap_native &operator&=(const T &x) { *this = ap_native(*this & x); return *this; }
+	template<typename T> ap_native &operator|=(const T &x) { *this = ap_native(*this | x); return *this; }
+	template<typename T> ap_native &operator^=(const T &x) { *this = ap_native(*this ^ x); return *this; }
+	ap_native &operator<<=(int sh) { *this = *this << sh; return *this; }
+	ap_native &operator>>=(int sh) { *this = *this >> sh; return *this; }
+
+	ap_native &operator++() { *this = ap_native((op_t)v + 1); return *this; }
+	ap_native &operator--() { *this = ap_native((op_t)v - 1); return *this; }
+	ap_native operator++(int) { ap_native t = *this; ++*this; return t; }
+	ap_native operator--(int) { ap_native t = *this; --*this; return t; }
+
+	/* ---- Casts and bits --- */
+	int to_int() const { return (int)v; }
+	unsigned to_uint() const { return (unsigned)v; }
+	long long to_int64() const { return (long long)v; }
+	unsigned long long to_uint64() const { return (unsigned long long)v; }
+	double to_double() const { return (double)v; }
+	bool operator[](int i) const { return ((op_t)v >> i) & 1; }
+	static int length() { return W; }
+};
+
+template<int W> using ap_int = ap_native<W, true>;
+template<int W> using ap_uint = ap_native<W, false>;
+
+#endif
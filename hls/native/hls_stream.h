@@ -0,0 +1,93 @@
+/*******************************************************************************
+--
+-- Title       : hls_stream.h
+-- Design      : Native HLS streams
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Lightweight replacement of vendor hls_stream.h for C simulation on plain
+--               Linux host: unbounded FIFO with blocking-style read / write API.
+--               Reading empty stream prints warning and returns default value.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef HLS_STREAM_NATIVE_H
+#define HLS_STREAM_NATIVE_H
+
+#include <stdio.h>
+#include <deque>
+
+namespace hls {
+
+template<typename T> class stream {
+	std::deque<T> fifo;
+	const char *name;
+
+public:
+	stream() : name("hls::stream") {}
+	explicit stream(const char *n) : name(n) {}
+
+	bool empty() const { return fifo.empty(); }
+	bool full() const { return false; }
+	size_t size() const { return fifo.size(); }
+
+	void write(const T &x) { fifo.push_back(x); }
+	bool write_nb(const T &x) { write(x); return true; }
+
+	T read() {
+		T x = T();
+		if (fifo.empty()) {
+			fprintf(stderr, "WARNING: read from empty stream %s\n", name);
+			return x;
+		}
+		x = fifo.front();
+		fifo.pop_front();
+		return x;
+	}
+	void read(T &x) { x = read(); }
+	bool read_nb(T &x) {
+		if (fifo.empty()) {
+			return false;
+		}
+		x = read();
+		return true;
+	}
+
+	void operator<<(const T &x) { write(x); }
+	void operator>>(T &x) { read(x); }
+};
+
+}
+
+#endif
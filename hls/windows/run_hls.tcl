@@ -0,0 +1,37 @@
+#
+# Title       : run_hls.tcl
+# Design      : Window functions by HLS
+# Author      : Kapitanov Alexander
+#
+# Description : C synthesis of win_function for each sine engine (SIN_TYPE).
+#               Latency and resource reports are copied to reports/<engine>.rpt
+#
+# Usage       : vivado_hls -f run_hls.tcl
+#
+
+set part  xcku040-ffva1156-2-e
+set clock 2.5
+
+file mkdir reports
+
+foreach {name type} {cordic 0 taylor 1 lut 2} {
+	open_project -reset prj_$name
+	set_top win_function
+	add_files win_function.cpp -cflags "-DSIN_TYPE=$type"
+	add_files win_stats.cpp
+	add_files -tb window_test.cpp -cflags "-DSIN_TYPE=$type"
+	add_files -tb ../../cpp/win_spectrum.cpp
+	add_files -tb ../../cpp/win_metrics.cpp
+	add_files -tb ../../cpp/win_model.cpp
+
+	open_solution -reset solution1
+	set_part $part
+	create_clock -period $clock
+
+	csynth_design
+	file copy -force prj_$name/solution1/syn/report/win_function_csynth.rpt reports/$name.rpt
+
+	close_project
+}
+
+exit
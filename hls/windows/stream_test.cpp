@@ -0,0 +1,123 @@
+/*******************************************************************************
+--
+-- Title       : stream_test.cpp
+-- Design      : Streaming window functions by HLS
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : C-sim testbench of AXI-Stream window top levels: compare each beat
+--               with win_function() at the same counter value, check TLAST.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "win_stream.h"
+
+/* ---- Window types to check (see win_function) --- */
+static const char win_types[] = {0x1, 0x2, 0x3, 0x4, 0x5, 0x7};
+
+int main () {
+
+	printf("!!! ************************************************ !!!\n");
+	printf("\nPhase = %d, Data = %d, Samples = %d Result: \n", NPHASE, NWIDTH, NSAMPLES);
+
+	int err_cnt = 0;
+	srand(1);
+
+	for (unsigned t = 0; t < sizeof(win_types); t++) {
+		const char sel = win_types[t];
+
+		hls::stream<win_axis_t> din;
+		hls::stream<win_axis_t> dgen;
+		hls::stream<win_axis_t> dmlt;
+
+		/* Random input samples of full scale */
+		for (int i = 0; i < NSAMPLES; i++) {
+			win_axis_t smp;
+			smp.data = (win_t) (((long long)rand() << 16) ^ rand());
+			smp.last = (i == NSAMPLES - 1);
+			din.write(smp);
+		}
+		hls::stream<win_axis_t> dref;
+		for (int i = 0; i < NSAMPLES; i++) {
+			win_axis_t smp = din.read();
+			dref.write(smp);
+			din.write(smp);
+		}
+
+		win_stream(sel, dgen);
+		win_multiply(sel, din, dmlt);
+
+		if ((dgen.size() != NSAMPLES) || (dmlt.size() != NSAMPLES) || !din.empty()) {
+			printf("Type 0x%X: wrong number of samples: %d, %d\n", sel, (int)dgen.size(), (int)dmlt.size());
+			err_cnt++;
+			continue;
+		}
+
+		int err_gen = 0;
+		int err_mlt = 0;
+		for (int i = 0; i < NSAMPLES; i++) {
+			win_t win;
+			win_function(sel, i, &win);
+
+			win_axis_t gen = dgen.read();
+			win_axis_t mlt = dmlt.read();
+			win_axis_t smp = dref.read();
+
+			/* Independent reference: double product, window peak is 1.0 */
+			const int shift = ((sel == 0x5) || (sel == 0x7)) ? 2 : 1;
+			double ref = floor((double)smp.data * (double)win / pow(2.0, NWIDTH - shift));
+			int last = (i == NSAMPLES - 1);
+
+			if ((gen.data != win) || (gen.last != last)) {
+				err_gen++;
+			}
+			if ((fabs((double)mlt.data - ref) > 1.0) || (mlt.last != last)) {
+				err_mlt++;
+			}
+		}
+		printf("Type 0x%X: generator errors = %d, multiplier errors = %d\n", sel, err_gen, err_mlt);
+		err_cnt += err_gen + err_mlt;
+	}
+
+	if (err_cnt) {
+		fprintf(stdout, "FAIL: Output DOES NOT match the golden output\n");
+	} else {
+		fprintf(stdout, "PASS: Data matches the golden output!\n");
+	}
+	return err_cnt ? 1 : 0;
+}
@@ -42,6 +42,7 @@
 *******************************************************************************/
 #include <math.h>
 #include "win_function.h"
+#include "win_stats.h"
 
 /* ---------------- CORDIC core ---------------- */
 void cordic (
@@ -55,6 +56,8 @@ void cordic (
 	#pragma HLS INTERFACE ap_none register port=out_sin
 	#pragma HLS PIPELINE
 
+	WIN_STATS_KERNEL(WIN_K_CORDIC);
+
 	// Create Look-up table array //
 	long long lut_table [48] = {
 		0x400000000000, 0x25C80A3B3BE6, 0x13F670B6BDC7, 0x0A2223A83BBB,
@@ -71,16 +74,17 @@ void cordic (
 		0x000000000005, 0x000000000003, 0x000000000001, 0x000000000000
 	};
 
-	static dat_t lut_angle[NWIDTH - 1];
+	static dat_t lut_angle[NITER];
 
 	int i;
-	for (i = 0; i < NWIDTH - 1; i++) {
-		lut_angle[i] = (lut_table[i] >> (48 - NWIDTH - 2 + 1) & 0xFFFFFFFFFF);
-		// lut_angle[i] = (dat_t)round(atan(pow(2.0, -i)) * pow(2.0, NWIDTH+1) / M_PI);
+	for (i = 0; i < NITER; i++) {
+		lut_angle[i] = (lut_table[i] >> (48 - NWIDTH - NPREC - 2 + 1) & 0xFFFFFFFFFF);
+		// lut_angle[i] = (dat_t)round(atan(pow(2.0, -i)) * pow(2.0, NWIDTH+NPREC+1) / M_PI);
 	}	
 
-	// Set data output gain level //
-	static const dat_t GAIN48 = (0x26DD3B6A10D8 >> (48 - NWIDTH - 2));
+	// Set data output gain level and PI/4 for residual angle //
+	static const dat_t GAIN48 = (0x26DD3B6A10D8 >> (48 - NWIDTH - NPREC - 2));
+	static const prd_t QPI48 = (0xC90FDAA22169 >> (48 - NWIDTH - NPREC - 2));
 
 	// Calculate quadrant and phase //
 	duo_t quadrant = phi_int >> (NPHASE - 2);
@@ -89,16 +93,16 @@ void cordic (
 	
 	dat_t init_z;
 	if ((NPHASE-1) < NWIDTH) {
-		init_z = init_t << (NWIDTH - NPHASE + 2);
+		init_z = init_t << (NWIDTH - NPHASE + 2 + NPREC);
 	}
 	else {
-		init_z = (init_t >> (NPHASE - NWIDTH)) << 2;
+		init_z = (init_t >> (NPHASE - NWIDTH)) << (2 + NPREC);
 	}	
 
 	// Create array for parallel calculation //
-	dat_t x[NWIDTH + 1];
-	dat_t y[NWIDTH + 1];
-	dat_t z[NWIDTH + 1];	
+	dat_t x[NITER + 1];
+	dat_t y[NITER + 1];
+	dat_t z[NITER + 1];	
 	
 	// Initial values //
 	x[0] = GAIN48;
@@ -107,7 +111,7 @@ void cordic (
 
 	// Unrolled loop //
 	int k;
-	stg: for (k = 0; k < NWIDTH; k++) {
+	stg: for (k = 0; k < NITER; k++) {
 	#pragma HLS UNROLL
 
 		if (z[k] < 0) {
@@ -123,10 +127,21 @@ void cordic (
 		}
 
 	} 	
+	WIN_STATS_ITER(NITER);
+
+	// Reduced iterations: Taylor tail from residual angle, cos(z) ~ 1, sin(z) ~ z //
+	dat_t x_tay = x[NITER];
+	dat_t y_tay = y[NITER];
+	if (NITER < NWIDTH) {
+		prd_t z_rad = (z[NITER] * QPI48) >> (NWIDTH + NPREC);
+
+		x_tay = x[NITER] - ((y[NITER] * z_rad) >> (NWIDTH + NPREC + 1));
+		y_tay = y[NITER] + ((x[NITER] * z_rad) >> (NWIDTH + NPREC + 1));
+	}
 
-	// Shift output data by 2 //
-	dat_t out_c = (x[NWIDTH] >> 2);
-	dat_t out_s = (y[NWIDTH] >> 2);
+	// Shift output data by 2 (and by extra precision bits) //
+	dat_t out_c = (x_tay >> (2 + NPREC));
+	dat_t out_s = (y_tay >> (2 + NPREC));
 
 	dat_t dat_c;
 	dat_t dat_s;
@@ -150,11 +165,187 @@ void cordic (
 	}
 	
 	// Get output values //
+	WIN_STATS_NARROW(WIN_N_CORDIC, dat_c, NWIDTH);
+	WIN_STATS_NARROW(WIN_N_CORDIC, dat_s, NWIDTH);
 	*out_cos = (dat_c);
 	*out_sin = (dat_s);
 
 }
 
+/* ---------------- Quarter-wave ROM: cos and sin of [0, PI/2) ---------------- */
+void sincos_rom (
+		win_t rom_cos[1 << LUT_SIZE],
+		win_t rom_sin[1 << LUT_SIZE]
+	)
+{
+	int i;
+	for (i = 0; i < (1 << LUT_SIZE); i++) {
+		double phi = (i * M_PI) / (2.0 * (1 << LUT_SIZE));
+		rom_cos[i] = (win_t) round(pow(2.0, NWIDTH-2) * cos(phi));
+		rom_sin[i] = (win_t) round(pow(2.0, NWIDTH-2) * sin(phi));
+	}
+}
+
+/* ---------------- Quadrant: sign and swap of cos and sin ---------------- */
+void sincos_quadrant (
+		duo_t quadrant,
+		win_t mem_c,
+		win_t mem_s,
+		win_t *out_cos,
+		win_t *out_sin
+	)
+{
+	#pragma HLS INLINE
+
+	if (quadrant == 0x0) {
+		*out_sin = mem_s;
+		*out_cos = mem_c;
+	}
+	else if (quadrant == 0x1) {
+		*out_sin = mem_c;
+		*out_cos = ~(mem_s) + 1;
+	}
+	else if (quadrant == 0x2) {
+		*out_sin = ~(mem_s) + 1;
+		*out_cos = ~(mem_c) + 1;
+	}
+	else {
+		*out_sin = ~(mem_c) + 1;
+		*out_cos = mem_s;
+	}
+}
+
+/* ---------------- Taylor: ROM and 1st order series (taylor_sincos.vhd) ---------------- */
+/*
+	ROM address is the MSBs of phase in quadrant, the rest of phase (acnt)
+	gives residual angle dphi = acnt * PI / 2^(NPHASE-1):
+		cos = cos_rom - dphi * sin_rom,
+		sin = sin_rom + dphi * cos_rom.
+	If (NPHASE-2) <= LUT_SIZE there is no residual angle and Taylor engine
+	is the same as LUT engine.
+*/
+void taylor_sincos (
+		phi_t phi_int,
+		win_t *out_cos,
+		win_t *out_sin
+	)
+{
+	#pragma HLS INTERFACE port=phi_int
+	#pragma HLS INTERFACE ap_none register port=out_cos
+	#pragma HLS INTERFACE ap_none register port=out_sin
+	#pragma HLS PIPELINE
+
+	static win_t rom_cos[1 << LUT_SIZE];
+	static win_t rom_sin[1 << LUT_SIZE];
+#ifndef __SYNTHESIS__
+	// C simulation: fill ROM once, no pow / cos / sin per sample //
+	static bool rom_init = false;
+	if (!rom_init) {
+		sincos_rom(rom_cos, rom_sin);
+		rom_init = true;
+	}
+#else
+	sincos_rom(rom_cos, rom_sin);
+#endif
+
+	duo_t quadrant = phi_int >> (NPHASE - 2);
+
+	ap_uint<NPHASE-2> cnt = phi_int;
+
+#if ((NPHASE - 2) <= LUT_SIZE)
+	adr_t addr = (adr_t)cnt << (LUT_SIZE - NPHASE + 2);
+
+	win_t mem_c = rom_cos[addr];
+	win_t mem_s = rom_sin[addr];
+#else
+#if ((NPHASE - LUT_SIZE) > 20)
+#error "taylor_sincos: NPHASE must be less than LUT_SIZE + 21"
+#endif
+	// Residual angle: PI * 2^(17-STAGE) as in tay1_order.vhd, STAGE = NPHASE-LUT_SIZE-3 //
+	const int XSHIFT = 19 + LUT_SIZE;
+	const tay_t MPI = round(M_PI * pow(2.0, 20 + LUT_SIZE - NPHASE));
+
+	adr_t addr = cnt >> (NPHASE - 2 - LUT_SIZE);
+	ap_uint<NPHASE-2-LUT_SIZE> acnt = cnt;
+
+	tay_t mpi = MPI * acnt;
+	tay_t rom_c = rom_cos[addr];
+	tay_t rom_s = rom_sin[addr];
+
+	tay_t sum_c = ((rom_c << XSHIFT) - mpi * rom_s) >> XSHIFT;
+	tay_t sum_s = ((rom_s << XSHIFT) + mpi * rom_c) >> XSHIFT;
+
+	// Scale overflow values (pr_rnd of tay1_order.vhd): near PI/2 the 1st order //
+	// series exceeds amplitude 2^(NWIDTH-2), saturate it 1 LSB below the peak   //
+	const tay_t AMAX = ((tay_t)1 << (NWIDTH - 2)) - 1;
+	if (sum_c > AMAX) sum_c = AMAX;
+	if (sum_c < -AMAX) sum_c = -AMAX;
+	if (sum_s > AMAX) sum_s = AMAX;
+	if (sum_s < -AMAX) sum_s = -AMAX;
+
+	win_t mem_c = sum_c;
+	win_t mem_s = sum_s;
+#endif
+
+	sincos_quadrant(quadrant, mem_c, mem_s, out_cos, out_sin);
+}
+
+/* ---------------- LUT: quarter-wave ROM, nearest lower phase ---------------- */
+void lut_sincos (
+		phi_t phi_int,
+		win_t *out_cos,
+		win_t *out_sin
+	)
+{
+	#pragma HLS INTERFACE port=phi_int
+	#pragma HLS INTERFACE ap_none register port=out_cos
+	#pragma HLS INTERFACE ap_none register port=out_sin
+	#pragma HLS PIPELINE
+
+	static win_t rom_cos[1 << LUT_SIZE];
+	static win_t rom_sin[1 << LUT_SIZE];
+#ifndef __SYNTHESIS__
+	// C simulation: fill ROM once, no pow / cos / sin per sample //
+	static bool rom_init = false;
+	if (!rom_init) {
+		sincos_rom(rom_cos, rom_sin);
+		rom_init = true;
+	}
+#else
+	sincos_rom(rom_cos, rom_sin);
+#endif
+
+	duo_t quadrant = phi_int >> (NPHASE - 2);
+
+	ap_uint<NPHASE-2> cnt = phi_int;
+
+#if ((NPHASE - 2) <= LUT_SIZE)
+	adr_t addr = (adr_t)cnt << (LUT_SIZE - NPHASE + 2);
+#else
+	adr_t addr = cnt >> (NPHASE - 2 - LUT_SIZE);
+#endif
+
+	sincos_quadrant(quadrant, rom_cos[addr], rom_sin[addr], out_cos, out_sin);
+}
+
+/* ---------------- Sine engine (SIN_TYPE) ---------------- */
+void sincos (
+		phi_t phi_int,
+		win_t *out_cos,
+		win_t *out_sin
+	)
+{
+	#pragma HLS INLINE off
+
+#if (SIN_TYPE == SIN_TAYLOR)
+	taylor_sincos(phi_int, out_cos, out_sin);
+#elif (SIN_TYPE == SIN_LUT)
+	lut_sincos(phi_int, out_cos, out_sin);
+#else
+	cordic(phi_int, out_cos, out_sin);
+#endif
+}
+
 /* ---------------- Window: Empty ---------------- */
 void win_empty (
 	phi_t i,
@@ -170,6 +361,8 @@ void win_hamming (
 	win_t* out_win
 	)
 {
+	WIN_STATS_KERNEL(WIN_K_HAMMING);
+
 	const double coeA0 = 0.5434783;
 	const double coeA1 = (1 - coeA0);
 
@@ -178,7 +371,8 @@ void win_hamming (
 	
 	win_t s, c;
 	
-	cordic(i, &c, &s);
+	sincos(i, &c, &s);
+	WIN_STATS_NARROW(WIN_N_OUT, a0 - ((a1 * c) >> (NWIDTH-2)), NWIDTH);
 	*out_win = (win_t) (a0 - ((a1 * c) >> (NWIDTH-2)));
 }
 
@@ -188,41 +382,77 @@ void win_hann (
 	win_t* out_win
 	)
 {
+	WIN_STATS_KERNEL(WIN_K_HANN);
+
 	const dbl_t a0 = round(0.5 * (pow(2.0, NWIDTH-1)-1.0));
 	const dbl_t a1 = round(0.5 * (pow(2.0, NWIDTH-1)-1.0));
 	
 	win_t s, c;
 
-	cordic(i, &c, &s);
+	sincos(i, &c, &s);
+	WIN_STATS_NARROW(WIN_N_OUT, a0 - ((a1 * c) >> (NWIDTH-2)), NWIDTH);
 	*out_win = (win_t) (a0 - ((a1 * c) >> (NWIDTH-2)));
 }
 
+/* ---------------- Harmonics: sum of (-1)^k * a[k] * cos(k*phi) ---------------- */
+/*
+	Folding: with NFOLD > 1 window is pipelined at II=NFOLD and only
+	NSINCOS engines are instantiated, each engine calculates NFOLD
+	harmonics in turn. Data path is the same for any NFOLD.
+*/
+dbl_t win_harmonics (
+	phi_t i,
+	const dbl_t a[NTERM],
+	const int nterm
+	)
+{
+	#pragma HLS INLINE
+	#pragma HLS ALLOCATION instances=sincos limit=NSINCOS function
+
+	dbl_t sum = a[0];
+
+	int k;
+	hrm: for (k = 1; k < NTERM; k++) {
+	#pragma HLS UNROLL
+		if (k < nterm) {
+			win_t s, c;
+			dbl_t mlt;
+
+			sincos(k*i, &c, &s);
+
+			mlt = (a[k] * c) >> (NWIDTH-2);
+
+			if (k & 0x1) {
+				sum = sum - mlt;
+			} else {
+				sum = sum + mlt;
+			}
+		}
+	}
+	return sum;
+}
+
 /* ---------------- Window: Blackman-Harris-3 ---------------- */
 void win_blackman_harris_3 (
 	phi_t i,
 	win_t* out_win
 	)
 {
+	WIN_STATS_KERNEL(WIN_K_BH3);
+
 	const double coeA0 = 0.21;
 	const double coeA1 = 0.25;
 	const double coeA2 = 0.04;
 
-	dbl_t a0 = round(coeA0 * (pow(2.0, NWIDTH-1)-1.0));
-	dbl_t a1 = round(coeA1 * (pow(2.0, NWIDTH-1)-1.0));
-	dbl_t a2 = round(coeA2 * (pow(2.0, NWIDTH-1)-1.0));
-	
-	win_t s1, c1, s2, c2;
-
-	dbl_t mlt1, mlt2;	
-	dbl_t sum;
+	dbl_t a[NTERM] = {0};
+	a[0] = round(coeA0 * (pow(2.0, NWIDTH-1)-1.0));
+	a[1] = round(coeA1 * (pow(2.0, NWIDTH-1)-1.0));
+	a[2] = round(coeA2 * (pow(2.0, NWIDTH-1)-1.0));
 
-	cordic(i, &c1, &s1);
-	cordic(2*i, &c2, &s2);
+	dbl_t sum = win_harmonics(i, a, 3);
 
-	mlt1 = (a1 * c1) >> (NWIDTH-2);
-	mlt2 = (a2 * c2) >> (NWIDTH-2);
-
-	*out_win = (win_t) (a0 - mlt1 + mlt2);
+	WIN_STATS_NARROW(WIN_N_OUT, sum, NWIDTH);
+	*out_win = (win_t) (sum);
 
 }
 
@@ -232,6 +462,8 @@ void win_blackman_harris_4 (
 	win_t* out_win
 	)
 {
+	WIN_STATS_KERNEL(WIN_K_BH4);
+
 	/*
 		> Blackman-Harris:
 			a0 = 0.35875, 
@@ -255,24 +487,16 @@ void win_blackman_harris_4 (
 	const double coeA2 = 0.14128;
 	const double coeA3 = 0.01168;
 
-	dbl_t a0 = round(coeA0 * (pow(2.0, NWIDTH-1)-1.0));
-	dbl_t a1 = round(coeA1 * (pow(2.0, NWIDTH-1)-1.0));
-	dbl_t a2 = round(coeA2 * (pow(2.0, NWIDTH-1)-1.0));
-	dbl_t a3 = round(coeA3 * (pow(2.0, NWIDTH-1)-1.0));
-	
-	win_t s1, c1, s2, c2, s3, c3;
+	dbl_t a[NTERM] = {0};
+	a[0] = round(coeA0 * (pow(2.0, NWIDTH-1)-1.0));
+	a[1] = round(coeA1 * (pow(2.0, NWIDTH-1)-1.0));
+	a[2] = round(coeA2 * (pow(2.0, NWIDTH-1)-1.0));
+	a[3] = round(coeA3 * (pow(2.0, NWIDTH-1)-1.0));
 
-	dbl_t mlt1, mlt2, mlt3;
+	dbl_t sum = win_harmonics(i, a, 4);
 
-	cordic(1*i, &c1, &s1);
-	cordic(2*i, &c2, &s2);
-	cordic(3*i, &c3, &s3);
-
-	mlt1 = (a1 * c1) >> (NWIDTH-2);
-	mlt2 = (a2 * c2) >> (NWIDTH-2);
-	mlt3 = (a3 * c3) >> (NWIDTH-2);
-	
-	*out_win = (win_t) (a0 - mlt1 + mlt2 - mlt3);
+	WIN_STATS_NARROW(WIN_N_OUT, sum, NWIDTH);
+	*out_win = (win_t) (sum);
 	
 }
 
@@ -282,6 +506,8 @@ void win_blackman_harris_5 (
 	win_t* out_win
 	)
 {
+	WIN_STATS_KERNEL(WIN_K_BH5);
+
 	/*
 		> Blackman-Harris:
 			a0 = 0.3232153788877343;
@@ -309,27 +535,17 @@ void win_blackman_harris_5 (
 	const double coeA3 = 0.0284969901061499;	
 	const double coeA4 = 0.0012613570882927;	
 
-	dbl_t a0 = round(coeA0 * (pow(2.0, NWIDTH-2)-1.0));
-	dbl_t a1 = round(coeA1 * (pow(2.0, NWIDTH-2)-1.0));
-	dbl_t a2 = round(coeA2 * (pow(2.0, NWIDTH-2)-1.0));
-	dbl_t a3 = round(coeA3 * (pow(2.0, NWIDTH-2)-1.0));
-	dbl_t a4 = round(coeA4 * (pow(2.0, NWIDTH-2)-1.0));
-	
-	win_t s1, c1, s2, c2, s3, c3, s4, c4;
+	dbl_t a[NTERM] = {0};
+	a[0] = round(coeA0 * (pow(2.0, NWIDTH-2)-1.0));
+	a[1] = round(coeA1 * (pow(2.0, NWIDTH-2)-1.0));
+	a[2] = round(coeA2 * (pow(2.0, NWIDTH-2)-1.0));
+	a[3] = round(coeA3 * (pow(2.0, NWIDTH-2)-1.0));
+	a[4] = round(coeA4 * (pow(2.0, NWIDTH-2)-1.0));
 
-	dbl_t mlt1, mlt2, mlt3, mlt4;	
-	
-	cordic(1*i, &c1, &s1);
-	cordic(2*i, &c2, &s2);
-	cordic(3*i, &c3, &s3);
-	cordic(4*i, &c4, &s4);
-
-	mlt1 = (a1 * c1) >> (NWIDTH-2);
-	mlt2 = (a2 * c2) >> (NWIDTH-2);
-	mlt3 = (a3 * c3) >> (NWIDTH-2);
-	mlt4 = (a4 * c4) >> (NWIDTH-2);
-		
-	*out_win = (win_t) (a0 - mlt1 + mlt2 - mlt3 + mlt4);
+	dbl_t sum = win_harmonics(i, a, 5);
+
+	WIN_STATS_NARROW(WIN_N_OUT, sum, NWIDTH);
+	*out_win = (win_t) (sum);
 }
 
 /* ---------------- Window: Blackman-Harris-7 ---------------- */
@@ -338,6 +554,8 @@ void win_blackman_harris_7 (
 	win_t* out_win
 	)
 {
+	WIN_STATS_KERNEL(WIN_K_BH7);
+
 	const double coeA0= 0.271220360585039;
 	const double coeA1= 0.433444612327442;
 	const double coeA2= 0.218004122892930;
@@ -346,33 +564,19 @@ void win_blackman_harris_7 (
 	const double coeA5= 0.000770012710581;
 	const double coeA6= 0.000013680883060;
 
-	dbl_t a0 = round(coeA0 * (pow(2.0, NWIDTH-2)-1.0));
-	dbl_t a1 = round(coeA1 * (pow(2.0, NWIDTH-2)-1.0));
-	dbl_t a2 = round(coeA2 * (pow(2.0, NWIDTH-2)-1.0));
-	dbl_t a3 = round(coeA3 * (pow(2.0, NWIDTH-2)-1.0));
-	dbl_t a4 = round(coeA4 * (pow(2.0, NWIDTH-2)-1.0));
-	dbl_t a5 = round(coeA5 * (pow(2.0, NWIDTH-2)-1.0));
-	dbl_t a6 = round(coeA6 * (pow(2.0, NWIDTH-2)-1.0));
-	
-	win_t s1, c1, s2, c2, s3, c3, s4, c4, s5, c5, s6, c6;
+	dbl_t a[NTERM] = {0};
+	a[0] = round(coeA0 * (pow(2.0, NWIDTH-2)-1.0));
+	a[1] = round(coeA1 * (pow(2.0, NWIDTH-2)-1.0));
+	a[2] = round(coeA2 * (pow(2.0, NWIDTH-2)-1.0));
+	a[3] = round(coeA3 * (pow(2.0, NWIDTH-2)-1.0));
+	a[4] = round(coeA4 * (pow(2.0, NWIDTH-2)-1.0));
+	a[5] = round(coeA5 * (pow(2.0, NWIDTH-2)-1.0));
+	a[6] = round(coeA6 * (pow(2.0, NWIDTH-2)-1.0));
 
-	dbl_t mlt1, mlt2, mlt3, mlt4, mlt5, mlt6;	
-	
-		cordic(1*i, &c1, &s1);
-		cordic(2*i, &c2, &s2);
-		cordic(3*i, &c3, &s3);
-		cordic(4*i, &c4, &s4);
-		cordic(5*i, &c5, &s5);
-		cordic(6*i, &c6, &s6);
-
-		mlt1 = (a1 * c1) >> (NWIDTH-2);
-		mlt2 = (a2 * c2) >> (NWIDTH-2);
-		mlt3 = (a3 * c3) >> (NWIDTH-2);
-		mlt4 = (a4 * c4) >> (NWIDTH-2);
-		mlt5 = (a5 * c5) >> (NWIDTH-2);
-		mlt6 = (a6 * c6) >> (NWIDTH-2);
-
-	*out_win = (win_t) (a0 - mlt1 + mlt2 - mlt3 + mlt4 - mlt5 + mlt6);
+	dbl_t sum = win_harmonics(i, a, 7);
+
+	WIN_STATS_NARROW(WIN_N_OUT, sum, NWIDTH);
+	*out_win = (win_t) (sum);
 
 }
 
@@ -386,7 +590,7 @@ void win_function (
 	#pragma HLS INTERFACE ap_none port=win_type
 	#pragma HLS INTERFACE ap_none port=i
 	#pragma HLS INTERFACE ap_none register port=out_win
-	#pragma HLS PIPELINE
+	#pragma HLS PIPELINE II=NFOLD
 
 	switch (win_type) 
 	{
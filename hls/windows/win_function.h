@@ -44,12 +44,49 @@
 // #include "ap_fixed.h"
 #include "ap_int.h"
 
-/* ---- Constants  --- */
+/* ---- Constants (can be overridden by win_tuner config) --- */
+#ifndef Wintype
 #define Wintype "Blackman-Harris-5"
+#endif
 
 /* ---- Output data width and input phase (counter) width  --- */
+#ifndef NPHASE
 #define NPHASE 10
+#endif
+#ifndef NWIDTH
 #define NWIDTH 24
+#endif
+
+/* ---- CORDIC: extra precision bits and number of iterations --- */
+#ifndef NPREC
+#define NPREC 0
+#endif
+#ifndef NITER
+#define NITER NWIDTH
+#endif
+
+/* ---- Sine engine: CORDIC, Taylor (ROM + 1st order) or ROM only --- */
+#define SIN_CORDIC 0
+#define SIN_TAYLOR 1
+#define SIN_LUT 2
+
+#ifndef SIN_TYPE
+#define SIN_TYPE SIN_CORDIC
+#endif
+
+/* ---- Quarter-wave ROM depth 2^LUT_SIZE for Taylor and LUT engines --- */
+#ifndef LUT_SIZE
+#define LUT_SIZE 10
+#endif
+
+/* ---- Folding: harmonics per CORDIC engine (1 - fully parallel, II=1) --- */
+#ifndef NFOLD
+#define NFOLD 1
+#endif
+
+/* ---- Max number of cosine terms and sine engines for harmonics --- */
+#define NTERM 7
+#define NSINCOS ((NTERM - 1 + NFOLD - 1) / NFOLD)
 
 #define NSAMPLES (int)pow(2, NPHASE)
 
@@ -58,9 +95,13 @@ typedef ap_int<NWIDTH> win_t;
 typedef ap_int<NPHASE> phi_t;
 
 typedef ap_int<2*NWIDTH+1> dbl_t;
-typedef ap_int<2+NWIDTH> dat_t;
+typedef ap_int<2+NWIDTH+NPREC> dat_t;
+typedef ap_int<2*(NWIDTH+NPREC)+4> prd_t;
 typedef ap_uint<2> duo_t;
 
+typedef ap_uint<LUT_SIZE> adr_t;
+typedef ap_int<NWIDTH+LUT_SIZE+21> tay_t;
+
 /* ---- Top level function --- */
 void win_function (
 	const char win_type,
@@ -0,0 +1,133 @@
+/*******************************************************************************
+--
+-- Title       : win_stats.cpp
+-- Design      : Window functions by HLS: instrumentation
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Counters for C simulation (-DWIN_STATS) and JSON snapshot
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include "win_stats.h"
+
+#if defined(WIN_STATS) && !defined(__SYNTHESIS__)
+
+#include <limits.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+static const char *kernel_name[WIN_K_NUM] = {
+	"cordic", "hamming", "hann", "blackman_harris_3", 
+	"blackman_harris_4", "blackman_harris_5", "blackman_harris_7"
+};
+
+static const char *narrow_name[WIN_N_NUM] = {
+	"cordic_out", "win_out"
+};
+
+static struct {
+	unsigned long long calls[WIN_K_NUM];
+	unsigned long long cycles[WIN_K_NUM];
+	unsigned long long iters;
+	unsigned long long casts[WIN_N_NUM];
+	unsigned long long wraps[WIN_N_NUM];
+	unsigned long long rails[WIN_N_NUM];
+} stats;
+
+unsigned long long win_stats_now (void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+void win_stats_call (int kernel)
+{
+	stats.calls[kernel]++;
+}
+
+void win_stats_iter (int count)
+{
+	stats.iters += count;
+}
+
+void win_stats_cycles (int kernel, unsigned long long cycles)
+{
+	stats.cycles[kernel] += cycles;
+}
+
+void win_stats_narrow (int site, long long val, int bits)
+{
+	const long long vmax = (bits >= 64) ? LLONG_MAX : (1LL << (bits - 1)) - 1;
+	const long long vmin = -vmax - 1;
+
+	stats.casts[site]++;
+	if ((val > vmax) || (val < vmin)) {
+		stats.wraps[site]++;
+	} else if ((val == vmax) || (val == vmin)) {
+		stats.rails[site]++;
+	}
+}
+
+void win_stats_reset (void)
+{
+	memset(&stats, 0, sizeof(stats));
+}
+
+void win_stats_json (FILE *fout)
+{
+	int k;
+	fprintf(fout, "{\n  \"kernels\": {\n");
+	for (k = 0; k < WIN_K_NUM; k++) {
+		fprintf(fout, "    \"%s\": {\"calls\": %llu, \"cycles\": %llu}%s\n", kernel_name[k], 
+			stats.calls[k], stats.cycles[k], (k + 1 < WIN_K_NUM) ? "," : "");
+	}
+	fprintf(fout, "  },\n  \"cordic_iterations\": %llu,\n  \"casts\": {\n", stats.iters);
+	for (k = 0; k < WIN_N_NUM; k++) {
+		fprintf(fout, "    \"%s\": {\"count\": %llu, \"wrap\": %llu, \"at_rail\": %llu}%s\n", narrow_name[k], 
+			stats.casts[k], stats.wraps[k], stats.rails[k], (k + 1 < WIN_N_NUM) ? "," : "");
+	}
+	fprintf(fout, "  }\n}\n");
+}
+
+#endif
@@ -0,0 +1,105 @@
+/*******************************************************************************
+--
+-- Title       : win_stats.h
+-- Design      : Window functions by HLS: instrumentation
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : Optional counters for C simulation: calls and cycles per kernel,
+--               CORDIC iterations, overflow (wrap) and values at rail (max / min) on narrowing casts.
+--               Enabled by -DWIN_STATS, compiles to nothing otherwise and in synthesis.
+--               Counters are not thread-safe: one C simulation per process.
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#ifndef WIN_STATS_H
+#define WIN_STATS_H
+
+/* ---- Kernels --- */
+enum {
+	WIN_K_CORDIC = 0,
+	WIN_K_HAMMING,
+	WIN_K_HANN,
+	WIN_K_BH3,
+	WIN_K_BH4,
+	WIN_K_BH5,
+	WIN_K_BH7,
+	WIN_K_NUM
+};
+
+/* ---- Narrowing casts --- */
+enum {
+	WIN_N_CORDIC = 0, // dat_t -> win_t at CORDIC output
+	WIN_N_OUT,        // window sum -> win_t
+	WIN_N_NUM
+};
+
+#if defined(WIN_STATS) && !defined(__SYNTHESIS__)
+
+#include <stdio.h>
+
+void win_stats_call (int kernel);
+void win_stats_iter (int count);
+void win_stats_narrow (int site, long long val, int bits);
+void win_stats_cycles (int kernel, unsigned long long cycles);
+unsigned long long win_stats_now (void);
+
+void win_stats_reset (void);
+void win_stats_json (FILE *fout);
+
+/* ---- Adds time from construction to end of scope to kernel --- */
+struct win_stats_timer {
+	int kernel;
+	unsigned long long start;
+	win_stats_timer(int k) : kernel(k), start(win_stats_now()) { win_stats_call(k); }
+	~win_stats_timer() { win_stats_cycles(kernel, win_stats_now() - start); }
+};
+
+#define WIN_STATS_KERNEL(k)            win_stats_timer win_stats_tmr_(k)
+#define WIN_STATS_ITER(n)              win_stats_iter(n)
+#define WIN_STATS_NARROW(s, val, bits) win_stats_narrow(s, (long long)(val), bits)
+#define WIN_STATS_RESET()              win_stats_reset()
+#define WIN_STATS_JSON(fout)           win_stats_json(fout)
+
+#else
+
+#define WIN_STATS_KERNEL(k)
+#define WIN_STATS_ITER(n)
+#define WIN_STATS_NARROW(s, val, bits)
+#define WIN_STATS_RESET()
+#define WIN_STATS_JSON(fout)
+
+#endif
+
+#endif
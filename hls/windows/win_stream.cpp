@@ -0,0 +1,111 @@
+/*******************************************************************************
+--
+-- Title       : win_stream.cpp
+-- Design      : Streaming window functions by HLS
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : AXI-Stream top levels of window functions. Phase is taken from
+--               internal counter as in VHDL cores (ENABLE / DT_VLD), one sample per
+--               clock (II=1). Each call (ap_start) gives one window of NSTREAM with
+--               TLAST on the last sample.
+--               
+--               win_multiply: dout = (din * w) >> (NWIDTH-1), window is Q1.(NWIDTH-1).
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include "win_stream.h"
+
+/* ---------------- Window generator ---------------- */
+void win_stream (
+		const char win_type,
+		hls::stream<win_axis_t> &dout
+	)
+{
+	#pragma HLS INTERFACE ap_none port=win_type
+	#pragma HLS INTERFACE axis port=dout
+	#pragma HLS INTERFACE ap_ctrl_hs port=return
+
+	phi_t cnt = 0;
+	win_t win = 0;
+
+	STREAM_GEN: for (int i = 0; i < NSTREAM; i++) {
+	#pragma HLS PIPELINE II=NFOLD
+		win_function(win_type, cnt, &win);
+
+		win_axis_t beat;
+		beat.data = win;
+		beat.last = (i == NSTREAM - 1);
+		dout.write(beat);
+		cnt++;
+	}
+}
+
+/* ---------------- Window multiplier ---------------- */
+
+/* ---- Window peak is 2^(NWIDTH-shift)-1: shift = 2 for BH5 and BH7, else 1 --- */
+static int win_gain_shift (
+		const char win_type
+	)
+{
+	return ((win_type == 0x5) || (win_type == 0x7)) ? NWIDTH - 2 : NWIDTH - 1;
+}
+
+void win_multiply (
+		const char win_type,
+		hls::stream<win_axis_t> &din,
+		hls::stream<win_axis_t> &dout
+	)
+{
+	#pragma HLS INTERFACE ap_none port=win_type
+	#pragma HLS INTERFACE axis port=din
+	#pragma HLS INTERFACE axis port=dout
+	#pragma HLS INTERFACE ap_ctrl_hs port=return
+
+	phi_t cnt = 0;
+	win_t win = 0;
+	const int sh = win_gain_shift(win_type);
+
+	STREAM_MLT: for (int i = 0; i < NSTREAM; i++) {
+	#pragma HLS PIPELINE II=NFOLD
+		win_axis_t smp = din.read();
+		win_function(win_type, cnt, &win);
+
+		win_axis_t beat;
+		beat.data = (win_t) ((dbl_t)(smp.data * win) >> sh);
+		beat.last = (i == NSTREAM - 1);
+		dout.write(beat);
+		cnt++;
+	}
+}
@@ -0,0 +1,66 @@
+/*******************************************************************************
+--
+-- Title       : win_stream.h
+-- Design      : Streaming window functions by HLS
+-- Author      : Kapitanov Alexander
+-- Company     : insys.ru
+-- E-mail      : sallador@bk.ru
+--
+-------------------------------------------------------------------------------
+--
+--	Version 1.0  18.10.2026
+--
+-------------------------------------------------------------------------------
+--
+-- Description : AXI-Stream top levels of window functions with internal phase counter
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2018 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+*******************************************************************************/
+#include "hls_stream.h"
+#include "win_function.h"
+
+/* ---- Window length as constant loop bound --- */
+#define NSTREAM (1 << NPHASE)
+
+/* ---- AXI-Stream beat: TDATA and TLAST (last sample of window) --- */
+typedef struct {
+	win_t data;
+	ap_uint<1> last;
+} win_axis_t;
+
+/* ---- Generate full window (NSTREAM) per start, II=1 --- */
+void win_stream (
+	const char win_type,
+	hls::stream<win_axis_t> &dout
+);
+
+/* ---- Multiply NSTREAM samples of input stream by window (unity gain at peak), II=1 --- */
+void win_multiply (
+	const char win_type,
+	hls::stream<win_axis_t> &din,
+	hls::stream<win_axis_t> &dout
+);
@@ -41,19 +41,32 @@
 -- 
 *******************************************************************************/
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <math.h>
 #include "win_function.h"
+#include "win_stats.h"
+#include "../../cpp/win_spectrum.h"
+#include "../../cpp/win_metrics.h"
+
+/* ---- Allowed loss of side-lobe level vs ideal window, dB --- */
+#define SLL_MARGIN 3.0
+
+/* ---- Side-lobe level limit of data width: 6 dB per bit --- */
+#define SLL_FLOOR (-6.0 * (NWIDTH - 2))
 
 int main () {
 
 	printf("!!! ************************************************ !!!\n");
 	printf("\nPhase = %d, Data = %d, Samples = %d Result: \n", NPHASE, NWIDTH, NSAMPLES);
 
+#ifdef DUMP_DATA
+	/* Text output for math/window_test.m */
 	FILE *fout;	FILE *fgld;	
 	fout = fopen("..\\..\\..\\..\\..\\math\\dout.dat", "w");	
 	fgld = fopen("..\\..\\..\\..\\..\\math\\golden_dat.dat", "w");	
+#endif
 	
 	/* Select window function type */
 	int sel = 0xFFFF;
@@ -76,16 +89,19 @@ int main () {
 	
 	
 	double calc_dbl;
-	win_t win_rnd[NSAMPLES];
-	win_t win_out[NSAMPLES];
+	win_t win_rnd;
+	win_t win_out;
 	win_t win_res;
+
+	double *win_hls = (double *)malloc(NSAMPLES * sizeof(double));
+	double *win_dbl = (double *)malloc(NSAMPLES * sizeof(double));
 	
 
 	int shift = 1;
 	printf("HLS Data: \t Golden Data:\n");
 	
 	/* Weight parameters */
-	double a0, a1, a2, a3, a4, a5, a6;
+	double a0 = 0, a1 = 0, a2 = 0, a3 = 0, a4 = 0, a5 = 0, a6 = 0;
 	
 	double acc_err = 0;
 	
@@ -191,29 +207,75 @@ int main () {
 		
 		/* Execute window function */
 		win_function(sel, i, &win_res);
-		win_out[i] = win_res;
+		win_out = win_res;
 
-		win_rnd[i] = (win_t) (round((pow(2.0, NWIDTH-shift)-1.0) * calc_dbl));
+		win_rnd = (win_t) (round((pow(2.0, NWIDTH-shift)-1.0) * calc_dbl));
 		
-		acc_err += pow(abs((double)win_rnd[i] - (double)win_out[i]), 2);
+		acc_err += pow(abs((double)win_rnd - (double)win_out), 2);
 		
-		fprintf(fout, "%d \n", (int)win_out[i]);
-		fprintf(fgld, "%d \n", (int)win_rnd[i]);
+		win_hls[i] = (double)win_out;
+		win_dbl[i] = calc_dbl;
+
+#ifdef DUMP_DATA
+		fprintf(fout, "%d \n", (int)win_out);
+		fprintf(fgld, "%d \n", (int)win_rnd);
+#endif
 
 		if (i < 16)
 		{
-			printf("%08X \t %08X\n", (int)win_out[i], (int)win_rnd[i]);
+			printf("%08X \t %08X\n", (int)win_out, (int)win_rnd);
 		}
 		
 	}
 	acc_err = sqrt(acc_err) / NSAMPLES;
 	
+#ifdef DUMP_DATA
 	fclose(fout);
-	fclose(fout);
+	fclose(fgld);
+#endif
+
+	printf("\nCalculation error between integer and double = %lf \n\n", acc_err);
+
+	/* Counters of win_function, only with -DWIN_STATS */
+	WIN_STATS_JSON(stdout);
+
+	/* Spectral check instead of math/window_test.m */
+	win_metrics_t met_dbl;
+	win_metrics_t met_hls;
+	win_metrics(win_dbl, NSAMPLES, &met_dbl);
+	win_metrics(win_hls, NSAMPLES, &met_hls);
+
+	// Golden window: reference only, no threshold //
+	printf("Golden: side-lobe level = %.2f dB, coherent gain = %.4f, ENBW = %.4f bins, scalloping loss = %.2f dB\n",
+		met_dbl.psll, met_dbl.cgain, met_dbl.enbw, met_dbl.scallop);
+	double psll_max = met_dbl.psll + SLL_MARGIN;
+	if (psll_max < SLL_FLOOR) {
+		psll_max = SLL_FLOOR;
+	}
+	int err_spec = win_verify("HLS", &met_hls, psll_max);
+
+	/* Closed-form metrics from coefficients must match the golden window */
+	double coe[7] = {a0, a1, a2, a3, a4, a5, a6};
+	win_gain_t gain_dbl;
+	win_gain_t gain_hls;
+	win_coe_metrics(coe, 7, NSAMPLES, 0, shift, &gain_dbl);
+	win_coe_metrics(coe, 7, NSAMPLES, NWIDTH, shift, &gain_hls);
+
+	printf("Closed-form: coherent gain = %.4f, ENBW = %.4f bins, processing loss = %.2f dB, scalloping loss = %.2f dB\n",
+		gain_dbl.cgain, gain_dbl.enbw, gain_dbl.ploss, gain_dbl.scallop);
+	printf("Closed-form (%d bits): coherent gain = %.4f, ENBW = %.4f bins, processing loss = %.2f dB, scalloping loss = %.2f dB\n",
+		NWIDTH, gain_hls.cgain, gain_hls.enbw, gain_hls.ploss, gain_hls.scallop);
+
+	if ((fabs(gain_dbl.cgain - met_dbl.cgain) > 1e-6) || (fabs(gain_dbl.enbw - met_dbl.enbw) > 1e-6) ||
+		(fabs(gain_dbl.scallop - met_dbl.scallop) > 1e-6)) {
+		printf("FAIL: closed-form metrics DO NOT match the golden window\n");
+		err_spec++;
+	}
 
-	printf("\nCalculation error between integer and double = %lf \n", acc_err);
+	free(win_hls);
+	free(win_dbl);
 
-	if (acc_err < 10) {
+	if ((acc_err < 10) && (err_spec == 0)) {
 		printf ("PASS: Data matches the golden output!\n");
 		return 0;
 	} else {
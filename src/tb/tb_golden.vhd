@@ -0,0 +1,245 @@
+-------------------------------------------------------------------------------
+--
+-- Title       : tb_golden
+-- Design      : Blackman-Harris Windows
+-- Author      : Kapitanov Alexander
+-- Company     : 
+-- E-mail      : sallador@bk.ru
+--
+-- Description : Check win_selector with golden file of cpp/tb_golden:
+--               constants AA0..AA6 are read from header of file, ENABLE is
+--               always '1' after reset, every DT_WIN with DT_VLD is compared
+--               with the next sample of the file.
+--
+--               Example (index.txt of tb_golden gives file for generics):
+--               vsim -gGOLDEN_FILE=golden/ab3b4dbc28694661.bin -gPHI_WIDTH=8 
+--                    -gDAT_WIDTH=12 -gWIN_TYPE=HAMMING tb_golden
+--
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+--
+--	GNU GENERAL PUBLIC LICENSE
+--  Version 3, 29 June 2007
+--
+--	Copyright (c) 2026 Kapitanov Alexander
+--
+--  This program is free software: you can redistribute it and/or modify
+--  it under the terms of the GNU General Public License as published by
+--  the Free Software Foundation, either version 3 of the License, or
+--  (at your option) any later version.
+--
+--  You should have received a copy of the GNU General Public License
+--  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+--
+--  THERE IS NO WARRANTY FOR THE PROGRAM, TO THE EXTENT PERMITTED BY
+--  APPLICABLE LAW. EXCEPT WHEN OTHERWISE STATED IN WRITING THE COPYRIGHT 
+--  HOLDERS AND/OR OTHER PARTIES PROVIDE THE PROGRAM "AS IS" WITHOUT WARRANTY 
+--  OF ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, 
+--  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+--  PURPOSE.  THE ENTIRE RISK AS TO THE QUALITY AND PERFORMANCE OF THE PROGRAM 
+--  IS WITH YOU.  SHOULD THE PROGRAM PROVE DEFECTIVE, YOU ASSUME THE COST OF 
+--  ALL NECESSARY SERVICING, REPAIR OR CORRECTION. 
+-- 
+-------------------------------------------------------------------------------
+-------------------------------------------------------------------------------
+
+library ieee; 
+use ieee.std_logic_1164.all; 
+use IEEE.std_logic_arith.all;
+use IEEE.std_logic_unsigned.all;
+
+entity tb_golden is
+	generic (
+		GOLDEN_FILE : string:="golden.bin"; --! Golden file of tb_golden
+		PHI_WIDTH   : integer:=10;          --! Signal period = 2^PHI_WIDTH
+		DAT_WIDTH   : integer:=16;          --! Output data width
+		WIN_TYPE    : string:="HAMMING";    --! Window type: HAMMING, BH3TERM, BH4TERM, BH5TERM, BH7TERM
+		SIN_TYPE    : string:="CORDIC";     --! Sine generator type: CORDIC / TAYLOR
+		LUT_SIZE    : integer:= 9;          --! ROM depth for sin/cos (TAYLOR)
+		XSERIES     : string:="ULTRA"       --! for 6/7 series: "7SERIES"; for ULTRASCALE: "ULTRA";
+	);
+end tb_golden;
+
+
+architecture testbench of tb_golden is
+
+    -------- Common Constants --------
+	constant CLK_PERIOD 	: time := 10 ns;
+	constant CLK_TD 		: time := 0.5 ns;
+	
+	-------- Golden file: "WGLD" + 16 words of header --------
+	constant GLD_WORDS		: integer:=16;
+	constant GLD_BYTES		: integer:=(DAT_WIDTH+7)/8;
+	
+	type char_file is file of character;
+	file fl_gld				: char_file open read_mode is GOLDEN_FILE;
+	
+	-------- Signal declaration --------
+	signal clk   			: std_logic:='0';
+	signal rst   			: std_logic:='1';
+	signal ena				: std_logic:='0';
+	signal sim_done			: std_logic:='0';
+	
+	type std_array_7xN is array (0 to 6) of std_logic_vector(DAT_WIDTH-1 downto 0); 
+	signal aa				: std_array_7xN:=(others => (others => '0'));
+	
+	signal dt_win			: std_logic_vector(DAT_WIDTH-1 downto 0);
+	signal dt_vld			: std_logic;
+	
+	-------- WIN_TYPE code in header of golden file --------
+	function win_code(xx : string) return integer is
+	begin
+		if (xx = "HAMMING") then
+			return 1;
+		elsif (xx = "BH3TERM") then
+			return 3;
+		elsif (xx = "BH4TERM") then
+			return 4;
+		elsif (xx = "BH5TERM") then
+			return 5;
+		elsif (xx = "BH7TERM") then
+			return 7;
+		end if;
+		return 0;
+	end win_code;
+	
+	-------- SIN_TYPE and LUT_SIZE in header (as vhd_normalize: used by HAMMING and BH3TERM only) --------
+	function sin_code(ww : string; xx : string) return integer is
+	begin
+		if ((ww = "HAMMING") or (ww = "BH3TERM")) and (xx = "TAYLOR") then
+			return 1;
+		end if;
+		return 0;
+	end sin_code;
+	
+	function lut_code(ww : string; xx : string; nn : integer) return integer is
+	begin
+		if (sin_code(ww, xx) = 1) then
+			return nn;
+		end if;
+		return 0;
+	end lut_code;
+	
+	-------- Read little-endian word of NB bytes --------
+	procedure read_word(file fl : char_file; nb : in integer; val : out std_logic_vector(31 downto 0)) is
+		variable ch		: character;
+	begin
+		val := (others => '0');
+		for ii in 0 to nb-1 loop
+			read(fl, ch);
+			val(8*ii+7 downto 8*ii) := conv_std_logic_vector(character'pos(ch), 8);
+		end loop;
+	end read_word;
+
+begin
+
+-------------------------------------------------------------------------------
+---------------- Clock and Reset Processes ------------------------------------
+-------------------------------------------------------------------------------
+clk_gen: process
+begin
+	if (sim_done = '1') then
+		wait;
+	end if;
+    clk <= '1';
+    wait for clk_period/2;
+    clk <= '0';
+    wait for clk_period/2;
+end process;
+
+rst_gen: process
+begin
+    rst <= '1';
+    wait for clk_period * 4;
+    rst <= '0';
+    wait;
+end process;
+
+ena <= '1' after CLK_TD when rising_edge(clk) and rst = '0';
+
+-------------------------------------------------------------------------------
+---------------- Window function: unit under test -----------------------------
+-------------------------------------------------------------------------------
+UUT: entity work.win_selector
+	generic map (
+		PHI_WIDTH   => PHI_WIDTH,
+		DAT_WIDTH   => DAT_WIDTH,
+		WIN_TYPE    => WIN_TYPE,
+		SIN_TYPE    => SIN_TYPE,
+		LUT_SIZE    => LUT_SIZE,
+		XSERIES     => XSERIES
+	)
+	port map (
+		RESET       => rst,
+		CLK         => clk,
+
+		AA0         => aa(0),
+		AA1         => aa(1),
+		AA2         => aa(2),
+		AA3         => aa(3),
+		AA4         => aa(4),
+		AA5         => aa(5),
+		AA6         => aa(6),
+		ENABLE      => ena,
+		DT_WIN      => dt_win,
+		DT_VLD      => dt_vld
+	);
+
+-------------------------------------------------------------------------------
+---------------- Compare DT_WIN with golden file ------------------------------
+-------------------------------------------------------------------------------
+pr_gld: process is
+	type int_array_Hx1 is array (0 to GLD_WORDS-1) of integer; 
+	variable hdr			: int_array_Hx1;
+	variable ch				: character;
+	variable vec			: std_logic_vector(31 downto 0);
+	variable magic			: string(1 to 4);
+	variable num			: integer:=0;
+	variable err			: integer:=0;
+begin
+	-- Header: VERSION, PHI_WIDTH, DAT_WIDTH, WIN_TYPE, SIN_TYPE, LUT_SIZE, XSERIES, COUNT, BYTES, AA0..AA6 --
+	for ii in 1 to 4 loop
+		read(fl_gld, ch);
+		magic(ii) := ch;
+	end loop;
+	for ii in 0 to 8 loop
+		read_word(fl_gld, 4, vec);
+		hdr(ii) := conv_integer(unsigned(vec(30 downto 0)));
+	end loop;
+	for ii in 0 to 6 loop
+		read_word(fl_gld, 4, vec);
+		aa(ii) <= vec(DAT_WIDTH-1 downto 0);
+	end loop;
+	
+	assert (magic = "WGLD") report "FAIL: wrong golden file " & GOLDEN_FILE severity failure;
+	assert (hdr(1) = PHI_WIDTH) and (hdr(2) = DAT_WIDTH) and (hdr(3) = win_code(WIN_TYPE)) and (hdr(8) = GLD_BYTES)
+		report "FAIL: generics do not match golden file " & GOLDEN_FILE severity failure;
+	assert (hdr(4) = sin_code(WIN_TYPE, SIN_TYPE)) and (hdr(5) = lut_code(WIN_TYPE, SIN_TYPE, LUT_SIZE))
+		report "FAIL: SIN_TYPE or LUT_SIZE does not match golden file " & GOLDEN_FILE severity failure;
+	
+	wait until rst = '0';
+	while (num < hdr(7)) loop
+		wait until rising_edge(clk);
+		if (dt_vld = '1') then
+			read_word(fl_gld, GLD_BYTES, vec);
+			if (dt_win /= vec(DAT_WIDTH-1 downto 0)) then
+				if (err < 16) then
+					report "Sample " & integer'image(num) & ": DT_WIN = " & integer'image(conv_integer(signed(dt_win)))
+						& ", golden = " & integer'image(conv_integer(signed(vec(DAT_WIDTH-1 downto 0)))) severity error;
+				end if;
+				err := err + 1;
+			end if;
+			num := num + 1;
+		end if;
+	end loop;
+	
+	if (err = 0) then
+		report "PASS: Data matches the golden output!" severity note;
+	else
+		report "FAIL: " & integer'image(err) & " of " & integer'image(num) & " samples differ" severity error;
+	end if;
+	sim_done <= '1';
+	wait;
+end process;
+
+end testbench;